@@ -4,6 +4,24 @@
 #define KEYPAD_ROWS		4
 #define KEYPAD_COLUM	4
 
+/**
+*	Options:
+			KEYPAD_POLLING		: HAL_Keypad_u8GetKey scans and waits for the key to be released
+			KEYPAD_INTERRUPT	: HAL_Keypad_voidScanTick is called from a periodic interrupt and
+								  gives each new key to the callback, it never waits
+*/
+#define KEYPAD_MODE		KEYPAD_INTERRUPT
+
+/*Interrupt mode, all in HAL_Keypad_voidScanTick calls (scan ticks):
+  a key changes state after reading its new state this many scans in a row (max 127)*/
+#define KEYPAD_DEBOUNCE_TICKS		4
+/*first repeat of a held key after this many scans, 0 for no repeat (max 255).
+  Off, the calculator takes no two digits or two operators in a row, so a repeat
+  would only raise an error*/
+#define KEYPAD_REPEAT_DELAY_TICKS	0
+/*then one repeat every this many scans (max 255)*/
+#define KEYPAD_REPEAT_RATE_TICKS	20
+
 
 extern u8 Keypad_Array[KEYPAD_ROWS][KEYPAD_COLUM];
 extern u8 Keypad_Rows[KEYPAD_ROWS];
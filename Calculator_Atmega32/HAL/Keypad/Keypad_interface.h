@@ -1,11 +1,32 @@
 #ifndef KEYPAD_INTERFACE_H_
 #define KEYPAD_INTERFACE_H_
 
+#include "StdTypes.h"
+
 #define KEYPAD_NO_KEY	0x00
 
+/*Kinds of key events*/
+#define KEYPAD_PRESS	0
+#define KEYPAD_RELEASE	1
+#define KEYPAD_REPEAT	2
+
+typedef struct
+{
+	u8 Key;		/*value from Keypad_Array*/
+	u8 Type;	/*KEYPAD_PRESS, KEYPAD_RELEASE or KEYPAD_REPEAT*/
+	u16 Time;	/*HAL_Keypad_voidScanTick calls since init, wraps*/
+}Keypad_Event_t;
+
 
 void HAL_Keypad_voidInit(void);
+/*Polling mode only*/
 u8   HAL_Keypad_u8GetKey(void);
+/*Interrupt mode only: call HAL_Keypad_voidScanTick from a periodic interrupt, every few ms.
+  Each key is debounced on its own and its press, release and repeat events are given to
+  the callback, from the interrupt.  The rows are held low between calls, so a call with
+  no key down or changing is one check of the columns*/
+void HAL_Keypad_voidScanTick(void);
+void HAL_Keypad_voidSetCallBack(void (*Copy_pvCallBack)(const Keypad_Event_t *Copy_pxEvent));
 
 
 
@@ -0,0 +1,29 @@
+#ifndef KEYPAD_PRIVATE_H_
+#define KEYPAD_PRIVATE_H_
+
+#define KEYPAD_POLLING		0
+#define KEYPAD_INTERRUPT	1
+
+#define KEYPAD_KEYS			(KEYPAD_ROWS * KEYPAD_COLUM)
+
+/*Per key debounce byte: the debounced state and the count of scans it has read otherwise*/
+#define KEYPAD_STATE_DOWN	0x80
+#define KEYPAD_COUNT_MASK	0x7F
+
+#if KEYPAD_MODE == KEYPAD_INTERRUPT
+#if KEYPAD_KEYS > 16
+#error The keypad scan keeps one bit per key in a u16
+#endif
+#if KEYPAD_COLUM > 4
+#error The ghost check counts the keys of a row with a 16 entry table
+#endif
+static void Keypad_voidInitParallel(void);
+static void Keypad_voidScanRows(u8 *Copy_pu8Columns);
+static u8 Keypad_u8IsGhost(const u8 *Copy_pu8Columns);
+static u16 Keypad_u16Scan(void);
+static u8 Keypad_u8AnyColumnLow(void);
+static u8 Keypad_u8UpdateKey(u8 Copy_u8Index,u8 Copy_u8Down);
+static void Keypad_voidSendEvent(u8 Copy_u8Index,u8 Copy_u8Type);
+#endif
+
+#endif /* KEYPAD_PRIVATE_H_ */
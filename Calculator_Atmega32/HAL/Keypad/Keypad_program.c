@@ -1,6 +1,33 @@
 #include "DIO_Interface.h"
 #include "Keypad_interface.h"
 #include "Keypad_cnfg.h"
+#include "Keypad_private.h"
+
+#if KEYPAD_MODE == KEYPAD_INTERRUPT
+static void (*Keypad_pvCallBack)(const Keypad_Event_t *Copy_pxEvent) = NULL_PTR;
+/*Two bytes of state per key, see Keypad_u8UpdateKey*/
+static u8 Keypad_u8Debounce[KEYPAD_KEYS];
+static u8 Keypad_u8Repeat[KEYPAD_KEYS];
+/*Set while any key is down or changing, the whole matrix is scanned then*/
+static u8 Keypad_u8Active = 0;
+static u16 Keypad_u16Time = 0;
+/*Last unambiguous scan, kept while a scan is ambiguous*/
+static u16 Keypad_u16LastKeys = 0;
+
+/*Port-parallel scan, used when the rows are on one port and the columns are consecutive
+  pins of one port: a row is driven with one port write and all columns are read with
+  one port read*/
+static u8 Keypad_u8Parallel = 0;
+static PORT_TYPE Keypad_xRowPort;
+static PORT_TYPE Keypad_xColumPort;
+static u8 Keypad_u8RowMask = 0;
+static u8 Keypad_u8ColumMask = 0;
+static u8 Keypad_u8ColumShift = 0;
+static u8 Keypad_u8RowBit[KEYPAD_ROWS];
+
+/*Number of keys down in a row, indexed by its column bits*/
+static const u8 Keypad_u8KeyCount[16] = {0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4};
+#endif
 
 
 
@@ -20,10 +47,15 @@ void HAL_Keypad_voidInit(void)
 	DIO_voidSetPinDirection(Keypad_Colum[2],INPULL);
 	DIO_voidSetPinDirection(Keypad_Colum[3],INPULL);
 	/*********/
+#if KEYPAD_MODE == KEYPAD_POLLING
 	DIO_voidWritePin(Keypad_Rows[0],HIGH);
 	DIO_voidWritePin(Keypad_Rows[1],HIGH);
 	DIO_voidWritePin(Keypad_Rows[2],HIGH);
 	DIO_voidWritePin(Keypad_Rows[3],HIGH);
+#else
+	/*Rows stay low (set by the output direction) so any key pulls its column low*/
+	Keypad_voidInitParallel();
+#endif
 }
 
 u8   HAL_Keypad_u8GetKey(void)
@@ -47,4 +79,227 @@ u8   HAL_Keypad_u8GetKey(void)
 		DIO_voidWritePin(Keypad_Rows[Local_u8Count1],HIGH);
 	}
 	return (Local_u8Key);
-}
\ No newline at end of file
+}
+
+#if KEYPAD_MODE == KEYPAD_INTERRUPT
+
+static void Keypad_voidInitParallel(void)
+{
+	u8 Local_u8Count=0;
+	Keypad_u8Parallel = 1;
+	Keypad_xRowPort = Keypad_Rows[0] / 8;
+	Keypad_xColumPort = Keypad_Colum[0] / 8;
+	Keypad_u8ColumShift = Keypad_Colum[0] % 8;
+	for(;Local_u8Count<KEYPAD_ROWS;Local_u8Count++)
+	{
+		Keypad_u8RowBit[Local_u8Count] = (MASK << (Keypad_Rows[Local_u8Count] % 8));
+		Keypad_u8RowMask |= Keypad_u8RowBit[Local_u8Count];
+		if(Keypad_xRowPort != (Keypad_Rows[Local_u8Count] / 8))
+		{
+			Keypad_u8Parallel = 0;
+		}
+	}
+	for(Local_u8Count=0;Local_u8Count<KEYPAD_COLUM;Local_u8Count++)
+	{
+		Keypad_u8ColumMask |= (MASK << (Keypad_Colum[Local_u8Count] % 8));
+		if((Keypad_Colum[0] + Local_u8Count) != Keypad_Colum[Local_u8Count])
+		{
+			Keypad_u8Parallel = 0;
+		}
+	}
+	/*Consecutive pins that run past bit 7 are on two ports*/
+	if((Keypad_u8ColumShift + KEYPAD_COLUM) > 8)
+	{
+		Keypad_u8Parallel = 0;
+	}
+}
+
+/*Drive one row low at a time and get the columns low (keys down) on it, bit n of an
+  entry is column n.  The rows are left low again*/
+static void Keypad_voidScanRows(u8 *Copy_pu8Columns)
+{
+	u8 Local_u8Count1=0;
+	u8 Local_u8Count2=0;
+	if(1 == Keypad_u8Parallel)
+	{
+		for(;Local_u8Count1<KEYPAD_ROWS;Local_u8Count1++)
+		{
+			DIO_voidWritePortMasked(Keypad_xRowPort,Keypad_u8RowMask,(u8)(Keypad_u8RowMask & ~Keypad_u8RowBit[Local_u8Count1]));
+			/*The call to the read gives the column inputs the cycle they need to settle*/
+			Copy_pu8Columns[Local_u8Count1] = (u8)((Keypad_u8ColumMask & ~DIO_u8ReadPortMasked(Keypad_xColumPort,Keypad_u8ColumMask)) >> Keypad_u8ColumShift);
+		}
+		DIO_voidClearPortMask(Keypad_xRowPort,Keypad_u8RowMask);
+	}
+	else
+	{
+		for(;Local_u8Count1<KEYPAD_ROWS;Local_u8Count1++)
+		{
+			DIO_voidWritePin(Keypad_Rows[Local_u8Count1],HIGH);
+		}
+		for(Local_u8Count1=0;Local_u8Count1<KEYPAD_ROWS;Local_u8Count1++)
+		{
+			DIO_voidWritePin(Keypad_Rows[Local_u8Count1],LOW);
+			Copy_pu8Columns[Local_u8Count1] = 0;
+			for(Local_u8Count2=0;Local_u8Count2<KEYPAD_COLUM;Local_u8Count2++)
+			{
+				if(LOW == DIO_xReadPinStatus(Keypad_Colum[Local_u8Count2]))
+				{
+					Copy_pu8Columns[Local_u8Count1] |= (MASK << Local_u8Count2);
+				}
+			}
+			DIO_voidWritePin(Keypad_Rows[Local_u8Count1],HIGH);
+		}
+		for(Local_u8Count1=0;Local_u8Count1<KEYPAD_ROWS;Local_u8Count1++)
+		{
+			DIO_voidWritePin(Keypad_Rows[Local_u8Count1],LOW);
+		}
+	}
+}
+
+/*Without diodes, three keys on the corners of a rectangle also connect the fourth corner,
+  so it reads down whether it is or not.  That is two rows sharing a column where one of
+  them has another key down*/
+static u8 Keypad_u8IsGhost(const u8 *Copy_pu8Columns)
+{
+	u8 Local_u8Ghost=0;
+	u8 Local_u8Count1=0;
+	u8 Local_u8Count2=0;
+	for(;Local_u8Count1<KEYPAD_ROWS;Local_u8Count1++)
+	{
+		for(Local_u8Count2=Local_u8Count1+1;Local_u8Count2<KEYPAD_ROWS;Local_u8Count2++)
+		{
+			if((0 != (Copy_pu8Columns[Local_u8Count1] & Copy_pu8Columns[Local_u8Count2])) &&
+			   ((1 < Keypad_u8KeyCount[Copy_pu8Columns[Local_u8Count1]]) || (1 < Keypad_u8KeyCount[Copy_pu8Columns[Local_u8Count2]])))
+			{
+				Local_u8Ghost = 1;
+			}
+		}
+	}
+	return (Local_u8Ghost);
+}
+
+/*Bit (row * KEYPAD_COLUM + column) is set for each key down.  Every key is reported on its
+  own (n-key rollover), except when the scan is ambiguous, the last good scan is kept then
+  so no key changes until the chord is released*/
+static u16 Keypad_u16Scan(void)
+{
+	u8 Local_u8Columns[KEYPAD_ROWS];
+	u8 Local_u8Count=0;
+	u16 Local_u16Keys=0;
+	Keypad_voidScanRows(Local_u8Columns);
+	if(0 == Keypad_u8IsGhost(Local_u8Columns))
+	{
+		for(;Local_u8Count<KEYPAD_ROWS;Local_u8Count++)
+		{
+			Local_u16Keys |= ((u16)Local_u8Columns[Local_u8Count] << (Local_u8Count * KEYPAD_COLUM));
+		}
+		Keypad_u16LastKeys = Local_u16Keys;
+	}
+	else
+	{
+		Local_u16Keys = Keypad_u16LastKeys;
+	}
+	return (Local_u16Keys);
+}
+
+/*With all rows low, any key down pulls its column low*/
+static u8 Keypad_u8AnyColumnLow(void)
+{
+	u8 Local_u8AnyKey=0;
+	u8 Local_u8Count=0;
+	if(1 == Keypad_u8Parallel)
+	{
+		Local_u8AnyKey = (Keypad_u8ColumMask != DIO_u8ReadPortMasked(Keypad_xColumPort,Keypad_u8ColumMask));
+	}
+	else
+	{
+		for(;Local_u8Count<KEYPAD_COLUM;Local_u8Count++)
+		{
+			if(LOW == DIO_xReadPinStatus(Keypad_Colum[Local_u8Count]))
+			{
+				Local_u8AnyKey = 1;
+			}
+		}
+	}
+	return (Local_u8AnyKey);
+}
+
+static void Keypad_voidSendEvent(u8 Copy_u8Index,u8 Copy_u8Type)
+{
+	Keypad_Event_t Local_xEvent;
+	Local_xEvent.Key  = Keypad_Array[Copy_u8Index / KEYPAD_COLUM][Copy_u8Index % KEYPAD_COLUM];
+	Local_xEvent.Type = Copy_u8Type;
+	Local_xEvent.Time = Keypad_u16Time;
+	if(NULL_PTR != Keypad_pvCallBack)
+	{
+		Keypad_pvCallBack(&Local_xEvent);
+	}
+}
+
+/*One scan of one key.  The state changes once the key has read the other state for
+  KEYPAD_DEBOUNCE_TICKS scans in a row, any bounce back starts the count again.  While the
+  key is down and steady its repeat byte counts down to the next repeat.  Returns 0 once
+  the key is up and steady*/
+static u8 Keypad_u8UpdateKey(u8 Copy_u8Index,u8 Copy_u8Down)
+{
+	u8 Local_u8Stable = (Keypad_u8Debounce[Copy_u8Index] & KEYPAD_STATE_DOWN) ? 1 : 0;
+	u8 Local_u8Count  = Keypad_u8Debounce[Copy_u8Index] & KEYPAD_COUNT_MASK;
+	if(Copy_u8Down != Local_u8Stable)
+	{
+		Local_u8Count++;
+		if(KEYPAD_DEBOUNCE_TICKS <= Local_u8Count)
+		{
+			Local_u8Stable = Copy_u8Down;
+			Local_u8Count = 0;
+			Keypad_u8Repeat[Copy_u8Index] = KEYPAD_REPEAT_DELAY_TICKS;
+			Keypad_voidSendEvent(Copy_u8Index,(1 == Local_u8Stable) ? KEYPAD_PRESS : KEYPAD_RELEASE);
+		}
+		else{/*Still bouncing or too short*/}
+	}
+	else
+	{
+		Local_u8Count = 0;
+#if KEYPAD_REPEAT_DELAY_TICKS > 0
+		if(1 == Local_u8Stable)
+		{
+			Keypad_u8Repeat[Copy_u8Index]--;
+			if(0 == Keypad_u8Repeat[Copy_u8Index])
+			{
+				Keypad_u8Repeat[Copy_u8Index] = KEYPAD_REPEAT_RATE_TICKS;
+				Keypad_voidSendEvent(Copy_u8Index,KEYPAD_REPEAT);
+			}
+		}
+#endif
+	}
+	Keypad_u8Debounce[Copy_u8Index] = (Local_u8Stable ? KEYPAD_STATE_DOWN : 0) | Local_u8Count;
+	return (Local_u8Stable | Local_u8Count);
+}
+
+void HAL_Keypad_voidScanTick(void)
+{
+	u16 Local_u16Keys=0;
+	u8 Local_u8Index=0;
+	Keypad_u16Time++;
+	if((0 == Keypad_u8Active) && (0 == Keypad_u8AnyColumnLow()))
+	{
+		/*All keys up and steady*/
+	}
+	else
+	{
+		Local_u16Keys = Keypad_u16Scan();
+		Keypad_u8Active = 0;
+		for(;Local_u8Index<KEYPAD_KEYS;Local_u8Index++)
+		{
+			if(0 != Keypad_u8UpdateKey(Local_u8Index,READ_BIT(Local_u16Keys,Local_u8Index)))
+			{
+				Keypad_u8Active = 1;
+			}
+		}
+	}
+}
+void HAL_Keypad_voidSetCallBack(void (*Copy_pvCallBack)(const Keypad_Event_t *Copy_pxEvent))
+{
+	Keypad_pvCallBack = Copy_pvCallBack;
+}
+
+#endif
@@ -27,6 +27,27 @@
 
 #define  LCD_SEND_MODE	LCD_PARALLEL
 
+/**
+*	Options (parallel mode only):
+			LCD_BUSY_FLAG	: RW is wired to LCD_RW, wait on the busy flag read back on D7
+			LCD_FIXED_DELAY	: RW is tied low, wait a fixed 2ms after every nibble
+			
+*/
+
+#define  LCD_WAIT_MODE	LCD_BUSY_FLAG
+
+/*Give up waiting for the busy flag after this many reads (about 10us each), 200 covers
+  the 1.52ms of the clear command with margin*/
+#define LCD_BUSY_TIMEOUT_POLLS	200
+
+/*Size of the asynchronous engine FIFO (parallel mode only), each line update takes one
+  entry per character plus one for the address command*/
+#define LCD_FIFO_SIZE			32
+
+/*Period of the timer 2 compare interrupt that drains the FIFO one nibble at a time, must
+  match TIMER_cnfig.h, 2 nibbles of 50us cover the 37us execution time of a byte*/
+#define LCD_ENGINE_TICK_US		50
+
 /*
 #define LCD_RS	DIO_PA3
 #define LCD_EN	DIO_PA2
@@ -40,6 +61,7 @@
 
 #define LCD_RS	DIO_PA1
 #define LCD_EN	DIO_PA2
+#define LCD_RW	DIO_PA0
 
 
 #define LCD_D4	DIO_PA3
@@ -35,4 +35,49 @@ extern void HAL_LCD_voidSendNumber(u32 Copy_u32Number);
 extern void HAL_LCD_voidGoTo(LCD_Line_t Copy_u8Line,u8 Copy_u8Cell);
 extern void HAL_LCD_voidClearLCD(void);
 
+#define LCD_OK			0
+#define LCD_FIFO_FULL	1
+
+/*
+*	Asynchronous engine (parallel mode only): the bytes are queued and sent one nibble per
+*	timer 2 interrupt, so the caller returns right away.  The synchronous functions above
+*	must not be used while the engine still has bytes to send.
+*/
+
+/**
+* @brief: queue a string to be written at the given line and cell.
+* @Param: Copy_u8Line		line to write to.
+* @Param: Copy_u8Cell		first cell of the line to write to.
+* @Param: Copy_pu8String	null terminated string, copied before returning.
+* @return: LCD_OK, or LCD_FIFO_FULL if the whole string does not fit, nothing is queued then.
+*/
+extern u8 HAL_LCD_u8WriteStringAsync(LCD_Line_t Copy_u8Line,u8 Copy_u8Cell,const char *Copy_pu8String);
+/**
+* @brief: set the function called from the timer interrupt each time the engine has sent
+*		  everything it was given.
+* @Param: Copy_pvCallBack	function to be called, NULL_PTR for none.
+*/
+extern void HAL_LCD_voidSetCallBack(void (*Copy_pvCallBack)(void));
+
+/*
+*	Shadow of the display: the writes only change a copy of the display in RAM, the
+*	flush then sends the cells that differ from what is on the display.  Any other
+*	write to the display after HAL_LCD_voidInit gets the shadow out of step.
+*/
+
+/**
+* @brief: write a string into the shadow, cut at the end of the line.
+* @Param: Copy_u8Line		line to write to.
+* @Param: Copy_u8Cell		first cell of the line to write to.
+* @Param: Copy_pu8String	null terminated string.
+*/
+extern void HAL_LCD_voidWriteShadow(LCD_Line_t Copy_u8Line,u8 Copy_u8Cell,const char *Copy_pu8String);
+/**
+* @brief: send the changed cells of the shadow, one address command per run of cells.
+*		  In parallel mode the runs are queued to the asynchronous engine.
+* @return: LCD_OK, or LCD_FIFO_FULL if some runs did not fit, flush again once the
+*		   engine has sent what it has.
+*/
+extern u8 HAL_LCD_u8FlushShadow(void);
+
 #endif /* LCD_INTERFACE_H_ */
\ No newline at end of file
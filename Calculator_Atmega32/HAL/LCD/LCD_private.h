@@ -25,7 +25,60 @@
 
 #define LCD_PARALLEL	2
 #define LCD_SERIAL		1
+
+#define LCD_FIXED_DELAY	0
+#define LCD_BUSY_FLAG	1
+
+/*D4..D7 on 4 consecutive pins of one port are written as one nibble.  The pins are enum
+  values the preprocessor can not see, so this is a constant expression and the compiler
+  drops the branch not taken*/
+#define LCD_DATA_CONTIGUOUS	((LCD_D5 == (LCD_D4 + 1)) && (LCD_D6 == (LCD_D4 + 2)) && \
+							 (LCD_D7 == (LCD_D4 + 3)) && ((LCD_D4 / 8) == (LCD_D7 / 8)))
+#define LCD_DATA_PORT		((PORT_TYPE)(LCD_D4 / 8))
+#define LCD_DATA_SHIFT		(LCD_D4 % 8)
+#define LCD_DATA_MASK		((u8)(0x0F << LCD_DATA_SHIFT))
+
+/*Enable pulse width and cycle, the HD44780 needs 450ns and 1us*/
+#define LCD_ENABLE_PULSE_US	1
+
+/*Clear and return home need 1.52ms, the engine sits out this many ticks after them*/
+#define LCD_LONG_COMMAND_TICKS	((1520 + LCD_ENGINE_TICK_US - 1) / LCD_ENGINE_TICK_US)
+
+/*Display size, for the shadow of the display*/
+#if LCD_TYPE == LCD_4_20
+#define LCD_ROWS		4
+#define LCD_COLUMNS		20
+#else
+#define LCD_ROWS		2
+#define LCD_COLUMNS		16
+#endif
+/*One bit per cell, set when the shadow cell differs from the display*/
+#define LCD_DIRTY_MAP_SIZE	(((LCD_ROWS * LCD_COLUMNS) + 7) / 8)
+
+/*A whole line and its address command have to fit in the engine FIFO at once*/
+#if (LCD_SEND_MODE == LCD_PARALLEL) && (LCD_FIFO_SIZE < (LCD_COLUMNS + 2))
+#error LCD_FIFO_SIZE is too small for one line of the display
+#endif
+
+/*One byte waiting in the asynchronous engine FIFO*/
+typedef struct
+{
+	u8 Value;
+	u8 IsData;
+}LCD_FifoEntry_t;
+
 static void LCD_voidWriteCommand(u8 Copy_xCommand);
 static void LCD_voidWriteData(u8 Copy_xData);
+#if (LCD_SEND_MODE == LCD_PARALLEL) && (LCD_WAIT_MODE == LCD_BUSY_FLAG)
+static void LCD_voidWaitBusy(void);
+static void LCD_voidWriteByte(u8 Copy_u8Byte);
+#endif
+static u8 LCD_u8GetAddress(LCD_Line_t Copy_u8Line,u8 Copy_u8Cell);
+static u8 LCD_u8SendRun(u8 Copy_u8Address,const u8 *Copy_pu8Data,u8 Copy_u8Length);
+static u8 LCD_u8IsDirty(u8 Copy_u8Row,u8 Copy_u8Cell);
+#if LCD_SEND_MODE == LCD_PARALLEL
+static void LCD_voidSendNibble(u8 Copy_u8Nibble);
+static void LCD_voidEngineStep(void);
+#endif
 
 #endif /* LCD_PRIVATE_H_ */
\ No newline at end of file
@@ -15,20 +15,212 @@
 
 /************ LCD Driver Includes *************/
 #include "LCD_interface.h"
-#include "LCD_private.h"
 #include "LCD_cnfig.h"
+#include "LCD_private.h"
 
 
 /*If serial communication with LCD is active then SPI is needed*/
 #if LCD_SEND_MODE	== LCD_SERIAL
 #include "SPI_interface.h"
+#else
+/*Timer 2 paces the asynchronous engine*/
+#include "TIMER_interface.h"
 #endif
 /**************** End of Inclusion section *************************************/
 
+/**************** Static variables *******************************************/
+
+#if LCD_SEND_MODE	== LCD_PARALLEL
+/*Asynchronous engine FIFO, the head is only moved by the writer and the tail only by the
+  timer interrupt, one slot is left empty to tell full from empty*/
+static LCD_FifoEntry_t LCD_xFifo[LCD_FIFO_SIZE];
+static volatile u8 LCD_u8FifoHead = 0;
+static volatile u8 LCD_u8FifoTail = 0;
+/*Engine state, only touched from the timer interrupt*/
+static u8 LCD_u8LowNibble = 0;
+static u8 LCD_u8WaitTicks = 0;
+static void (*LCD_pvCallBack)(void) = NULL_PTR;
+#endif
+
+/*Shadow of the display and the cells of it not sent yet*/
+static u8 LCD_u8Shadow[LCD_ROWS][LCD_COLUMNS];
+static u8 LCD_u8DirtyMap[LCD_DIRTY_MAP_SIZE];
+
 /**************** Static functions implementations ****************************/
 
+static u8 LCD_u8GetAddress(LCD_Line_t Copy_u8Line,u8 Copy_u8Cell)
+{
+	u8 Local_u8Address = 0x80;
+	switch(Copy_u8Line)
+	{
+	case LINE1:		Local_u8Address = 0x80;
+		break;
+	case LINE2:		Local_u8Address = 0xC0;
+		break;
+	case LINE3:		Local_u8Address = 0x94;
+		break;
+	case LINE4:		Local_u8Address = 0xD4;
+		break;
+	}
+	return Local_u8Address | Copy_u8Cell;
+}
+
+static u8 LCD_u8IsDirty(u8 Copy_u8Row,u8 Copy_u8Cell)
+{
+	u8 Local_u8Index = (Copy_u8Row * LCD_COLUMNS) + Copy_u8Cell;
+	return READ_BIT(LCD_u8DirtyMap[Local_u8Index >> 3],(Local_u8Index & 7));
+}
+
 #if LCD_SEND_MODE	== LCD_PARALLEL
 
+/*Put the low 4 bits on D7..D4 and clock them in, RS and RW are left to the caller*/
+static void LCD_voidSendNibble(u8 Copy_u8Nibble)
+{
+	if(LCD_DATA_CONTIGUOUS)
+	{
+		DIO_voidWritePortMasked(LCD_DATA_PORT,LCD_DATA_MASK,(u8)((Copy_u8Nibble & 0x0F) << LCD_DATA_SHIFT));
+	}
+	else
+	{
+		DIO_WRITE_PIN(LCD_D7,READ_BIT(Copy_u8Nibble,3));
+		DIO_WRITE_PIN(LCD_D6,READ_BIT(Copy_u8Nibble,2));
+		DIO_WRITE_PIN(LCD_D5,READ_BIT(Copy_u8Nibble,1));
+		DIO_WRITE_PIN(LCD_D4,READ_BIT(Copy_u8Nibble,0));
+	}
+	DIO_SET_PIN(LCD_EN);
+	_delay_us(LCD_ENABLE_PULSE_US);
+	DIO_CLR_PIN(LCD_EN);
+}
+
+/*Queue an address command followed by the bytes, all or nothing*/
+static u8 LCD_u8SendRun(u8 Copy_u8Address,const u8 *Copy_pu8Data,u8 Copy_u8Length)
+{
+	u8 Local_u8ErrorState = LCD_OK;
+	u8 Local_u8Head = LCD_u8FifoHead;
+	u8 Local_u8Free = (LCD_u8FifoTail + LCD_FIFO_SIZE - Local_u8Head - 1) % LCD_FIFO_SIZE;
+	/*One more entry for the address command*/
+	if(Copy_u8Length >= Local_u8Free)
+	{
+		Local_u8ErrorState = LCD_FIFO_FULL;
+	}
+	else
+	{
+		LCD_xFifo[Local_u8Head].Value = Copy_u8Address;
+		LCD_xFifo[Local_u8Head].IsData = 0;
+		Local_u8Head = (Local_u8Head + 1) % LCD_FIFO_SIZE;
+		for(;Copy_u8Length;Copy_u8Length--,Copy_pu8Data++)
+		{
+			LCD_xFifo[Local_u8Head].Value = *Copy_pu8Data;
+			LCD_xFifo[Local_u8Head].IsData = 1;
+			Local_u8Head = (Local_u8Head + 1) % LCD_FIFO_SIZE;
+		}
+		/*Publish the entries only once they are all written*/
+		LCD_u8FifoHead = Local_u8Head;
+		TIMER2_voidEnableInterrupt();
+	}
+	return Local_u8ErrorState;
+}
+
+/*Timer 2 callback, sends one nibble of the FIFO per call.  Nothing is read back from the
+  LCD, a tick is longer than the execution time of a byte except for clear and home*/
+static void LCD_voidEngineStep(void)
+{
+	LCD_FifoEntry_t *Local_pxEntry;
+	if(LCD_u8WaitTicks > 0)
+	{
+		LCD_u8WaitTicks--;
+	}
+	else if(LCD_u8FifoTail == LCD_u8FifoHead)
+	{
+		TIMER2_voidDisableInterrupt();
+		if(NULL_PTR != LCD_pvCallBack)
+		{
+			LCD_pvCallBack();
+		}
+	}
+	else
+	{
+		Local_pxEntry = &LCD_xFifo[LCD_u8FifoTail];
+		if(0 == LCD_u8LowNibble)
+		{
+			DIO_WRITE_PIN(LCD_RS,(Logic_TYPE)Local_pxEntry->IsData);
+			LCD_voidSendNibble(Local_pxEntry->Value >> 4);
+			LCD_u8LowNibble = 1;
+		}
+		else
+		{
+			LCD_voidSendNibble(Local_pxEntry->Value);
+			LCD_u8LowNibble = 0;
+			/*Clear (0x01) and return home (0x02, 0x03) are the only slow commands*/
+			if((0 == Local_pxEntry->IsData) && (Local_pxEntry->Value < 0x04))
+			{
+				LCD_u8WaitTicks = LCD_LONG_COMMAND_TICKS;
+			}
+			LCD_u8FifoTail = (LCD_u8FifoTail + 1) % LCD_FIFO_SIZE;
+		}
+	}
+}
+
+#if LCD_WAIT_MODE == LCD_BUSY_FLAG
+
+/*Read the busy flag until the LCD is ready for the next byte, the read is 2 nibbles
+  as the LCD is in 4 bit mode, the busy flag is D7 of the first one.  The LCD drives
+  all of D7..D4 in a read, so they are all inputs while RW is high*/
+static void LCD_voidWaitBusy(void)
+{
+	u16 Local_u16Polls = 0;
+	Logic_TYPE Local_xBusyFlag = HIGH;
+	DIO_SET_PIN_DIRECTION(LCD_D4,INFREE);
+	DIO_SET_PIN_DIRECTION(LCD_D5,INFREE);
+	DIO_SET_PIN_DIRECTION(LCD_D6,INFREE);
+	DIO_SET_PIN_DIRECTION(LCD_D7,INFREE);
+	DIO_CLR_PIN(LCD_RS);
+	DIO_SET_PIN(LCD_RW);
+	while((HIGH == Local_xBusyFlag) && (Local_u16Polls < LCD_BUSY_TIMEOUT_POLLS))
+	{
+		DIO_SET_PIN(LCD_EN);
+		_delay_us(LCD_ENABLE_PULSE_US);
+		Local_xBusyFlag = DIO_READ_PIN(LCD_D7);
+		DIO_CLR_PIN(LCD_EN);
+		_delay_us(LCD_ENABLE_PULSE_US);
+		/*Second nibble (address counter) is not needed but must be clocked out*/
+		DIO_SET_PIN(LCD_EN);
+		_delay_us(LCD_ENABLE_PULSE_US);
+		DIO_CLR_PIN(LCD_EN);
+		_delay_us(LCD_ENABLE_PULSE_US);
+		Local_u16Polls++;
+	}
+	DIO_CLR_PIN(LCD_RW);
+	DIO_SET_PIN_DIRECTION(LCD_D4,OUTPUT);
+	DIO_SET_PIN_DIRECTION(LCD_D5,OUTPUT);
+	DIO_SET_PIN_DIRECTION(LCD_D6,OUTPUT);
+	DIO_SET_PIN_DIRECTION(LCD_D7,OUTPUT);
+}
+
+/*RS has to be set by the caller after LCD_voidWaitBusy as the busy read clears it*/
+static void LCD_voidWriteByte(u8 Copy_u8Byte)
+{
+	LCD_voidSendNibble(Copy_u8Byte >> 4);
+	_delay_us(LCD_ENABLE_PULSE_US);
+	LCD_voidSendNibble(Copy_u8Byte);
+}
+
+/*Wait before writing rather than after, so the LCD executes while the caller carries on*/
+static void LCD_voidWriteCommand(u8 Copy_xCommand)
+{
+	LCD_voidWaitBusy();
+	DIO_CLR_PIN(LCD_RS);
+	LCD_voidWriteByte(Copy_xCommand);
+}
+static void LCD_voidWriteData(u8 Copy_xData)
+{
+	LCD_voidWaitBusy();
+	DIO_SET_PIN(LCD_RS);
+	LCD_voidWriteByte(Copy_xData);
+}
+
+#else
+
 static void LCD_voidWriteCommand(u8 Copy_xCommand)
 {
 	DIO_voidWritePin(LCD_RS,LOW);
@@ -73,6 +265,7 @@ static void LCD_voidWriteData(u8 Copy_xData)
 	_delay_ms(2);
 	
 }
+#endif
 #elif LCD_SEND_MODE	== LCD_SERIAL
 
 	static void LCD_voidWriteCommand(u8 Copy_xCommand)
@@ -110,12 +303,24 @@ static void LCD_voidWriteData(u8 Copy_xData)
 		
 	}
 
+	/*No engine in serial mode, the run is sent before returning*/
+	static u8 LCD_u8SendRun(u8 Copy_u8Address,const u8 *Copy_pu8Data,u8 Copy_u8Length)
+	{
+		LCD_voidWriteCommand(Copy_u8Address);
+		for(;Copy_u8Length;Copy_u8Length--,Copy_pu8Data++)
+		{
+			LCD_voidWriteData(*Copy_pu8Data);
+		}
+		return LCD_OK;
+	}
 
 #endif
 /**************** External functions implementations ****************************/
 
 void HAL_LCD_voidInit(void)
 {
+	u8 Local_u8Row;
+	u8 Local_u8Cell;
 	#if LCD_SEND_MODE == LCD_SERIAL
 	SPI_voidInit();
 	#endif
@@ -126,10 +331,22 @@ void HAL_LCD_voidInit(void)
 	DIO_voidSetPinDirection(LCD_D7,OUTPUT);
 	DIO_voidSetPinDirection(LCD_RS,OUTPUT);
 	DIO_voidSetPinDirection(LCD_EN,OUTPUT);
+	#if (LCD_SEND_MODE == LCD_PARALLEL) && (LCD_WAIT_MODE == LCD_BUSY_FLAG)
+	DIO_voidSetPinDirection(LCD_RW,OUTPUT);
+	#endif
 	/*Start Init algorithm*/
 	_delay_ms(40);
+	#if (LCD_SEND_MODE == LCD_PARALLEL) && (LCD_WAIT_MODE == LCD_BUSY_FLAG)
+	/*The busy flag can not be read before the 4 bit function set is done, so these
+	  two wait a fixed time instead*/
+	DIO_CLR_PIN(LCD_RS);
+	LCD_voidWriteByte(_4_BITCOMMAND);
+	_delay_ms(2);
+	LCD_voidWriteByte(FUNCTION_SET);
+	#else
 	LCD_voidWriteCommand(_4_BITCOMMAND);
 	LCD_voidWriteCommand(FUNCTION_SET);
+	#endif
 	_delay_ms(2);
 	LCD_voidWriteCommand(DISP_ON_OFF);
 	_delay_ms(2);
@@ -137,6 +354,19 @@ void HAL_LCD_voidInit(void)
 	_delay_ms(2);
 	LCD_voidWriteCommand(ENTRY_MODE);
 	_delay_ms(2);
+	/*The display is clear, so is the shadow*/
+	for(Local_u8Row=0;Local_u8Row<LCD_ROWS;Local_u8Row++)
+	{
+		for(Local_u8Cell=0;Local_u8Cell<LCD_COLUMNS;Local_u8Cell++)
+		{
+			LCD_u8Shadow[Local_u8Row][Local_u8Cell] = ' ';
+		}
+	}
+	#if LCD_SEND_MODE == LCD_PARALLEL
+	/*The engine interrupt is only enabled while the FIFO has something in it*/
+	TIMER2_voidSetCallBack(&LCD_voidEngineStep);
+	TIMER2_voidInit();
+	#endif
 }
 
 void HAL_LCD_voidSendChar(u8 Copy_u8Char)
@@ -178,22 +408,88 @@ void HAL_LCD_voidSendNumber(u32 Copy_u32Number)
 }
 void HAL_LCD_voidGoTo(LCD_Line_t Copy_u8Line,u8 Copy_u8Cell)
 {
-	switch(Copy_u8Line)
-	{
-	case LINE1:		LCD_voidWriteCommand(0x80 | Copy_u8Cell);
-		break;
-	case LINE2:		LCD_voidWriteCommand(0xC0 | Copy_u8Cell);
-		break;
-	case LINE3:		LCD_voidWriteCommand(0x94 | Copy_u8Cell);
-		break;
-	case LINE4:		LCD_voidWriteCommand(0xD4 | Copy_u8Cell);
-		break;
-	}
+	LCD_voidWriteCommand(LCD_u8GetAddress(Copy_u8Line,Copy_u8Cell));
 }
 
 void HAL_LCD_voidClearLCD(void)
 {
 	LCD_voidWriteCommand(DISP_CLEAR);
+	#if (LCD_SEND_MODE == LCD_SERIAL) || (LCD_WAIT_MODE == LCD_FIXED_DELAY)
 	_delay_ms(2);	
+	#endif
+}
+
+#if LCD_SEND_MODE == LCD_PARALLEL
+
+u8 HAL_LCD_u8WriteStringAsync(LCD_Line_t Copy_u8Line,u8 Copy_u8Cell,const char *Copy_pu8String)
+{
+	u8 Local_u8Length = 0;
+	while(Copy_pu8String[Local_u8Length])
+	{
+		Local_u8Length++;
+	}
+	return LCD_u8SendRun(LCD_u8GetAddress(Copy_u8Line,Copy_u8Cell),(const u8 *)Copy_pu8String,Local_u8Length);
+}
+void HAL_LCD_voidSetCallBack(void (*Copy_pvCallBack)(void))
+{
+	LCD_pvCallBack = Copy_pvCallBack;
 }
 
+#endif
+
+void HAL_LCD_voidWriteShadow(LCD_Line_t Copy_u8Line,u8 Copy_u8Cell,const char *Copy_pu8String)
+{
+	u8 Local_u8Index;
+	for(;(*Copy_pu8String) && (Copy_u8Cell < LCD_COLUMNS);Copy_pu8String++,Copy_u8Cell++)
+	{
+		if(LCD_u8Shadow[Copy_u8Line][Copy_u8Cell] != (u8)*Copy_pu8String)
+		{
+			LCD_u8Shadow[Copy_u8Line][Copy_u8Cell] = *Copy_pu8String;
+			Local_u8Index = (Copy_u8Line * LCD_COLUMNS) + Copy_u8Cell;
+			SET_BIT(LCD_u8DirtyMap[Local_u8Index >> 3],(Local_u8Index & 7));
+		}
+	}
+}
+u8 HAL_LCD_u8FlushShadow(void)
+{
+	u8 Local_u8ErrorState = LCD_OK;
+	u8 Local_u8Row;
+	u8 Local_u8Start;
+	u8 Local_u8End;
+	u8 Local_u8Index;
+	for(Local_u8Row=0;(Local_u8Row<LCD_ROWS) && (LCD_OK == Local_u8ErrorState);Local_u8Row++)
+	{
+		Local_u8Start = 0;
+		while((Local_u8Start < LCD_COLUMNS) && (LCD_OK == Local_u8ErrorState))
+		{
+			if(0 == LCD_u8IsDirty(Local_u8Row,Local_u8Start))
+			{
+				Local_u8Start++;
+			}
+			else
+			{
+				/*Extend the run over one clean cell too, resending it costs the same as
+				  the address command of a new run*/
+				Local_u8End = Local_u8Start + 1;
+				while((Local_u8End < LCD_COLUMNS) &&
+					  (LCD_u8IsDirty(Local_u8Row,Local_u8End) ||
+					  (((Local_u8End + 1) < LCD_COLUMNS) && LCD_u8IsDirty(Local_u8Row,Local_u8End + 1))))
+				{
+					Local_u8End++;
+				}
+				Local_u8ErrorState = LCD_u8SendRun(LCD_u8GetAddress((LCD_Line_t)Local_u8Row,Local_u8Start),
+												  &LCD_u8Shadow[Local_u8Row][Local_u8Start],Local_u8End - Local_u8Start);
+				if(LCD_OK == Local_u8ErrorState)
+				{
+					for(;Local_u8Start<Local_u8End;Local_u8Start++)
+					{
+						Local_u8Index = (Local_u8Row * LCD_COLUMNS) + Local_u8Start;
+						CLR_BIT(LCD_u8DirtyMap[Local_u8Index >> 3],(Local_u8Index & 7));
+					}
+				}
+				else{/*Keep the rest dirty for the next flush*/}
+			}
+		}
+	}
+	return Local_u8ErrorState;
+}
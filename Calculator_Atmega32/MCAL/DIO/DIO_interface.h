@@ -10,6 +10,7 @@
 #define DIO_INTERFACE_H_
 
 #include "StdTypes.h"
+#include "Utiles.h"
 
 typedef enum
 {
@@ -79,6 +80,39 @@ extern void DIO_voidTogglePin(PIN_TYPE Copy_xPin);
 extern Logic_TYPE DIO_xReadPinStatus(PIN_TYPE Copy_xPin);
 
 extern void DIO_voidWritePort(PORT_TYPE Copy_xPort, u8 Copy_u8Value);
+/*
+*	Masked port operations, only the pins set in Copy_u8Mask are touched.  Each is a single
+*	access of the port register with interrupts disabled, so they are safe against ISRs
+*	using other pins of the same port.
+*/
+extern void DIO_voidWritePortMasked(PORT_TYPE Copy_xPort, u8 Copy_u8Mask, u8 Copy_u8Value);
+extern void DIO_voidSetPortMask(PORT_TYPE Copy_xPort, u8 Copy_u8Mask);
+extern void DIO_voidClearPortMask(PORT_TYPE Copy_xPort, u8 Copy_u8Mask);
+extern void DIO_voidTogglePortMask(PORT_TYPE Copy_xPort, u8 Copy_u8Mask);
+extern u8 DIO_u8ReadPortMasked(PORT_TYPE Copy_xPort, u8 Copy_u8Mask);
+
+/*
+*	Pin access for pins known at compile time (a PIN_TYPE constant or a macro of one).
+*	The register address and the bit fold to constants, so each access is a single
+*	sbi, cbi or sbis/sbic instruction, and setting or clearing one pin can not be
+*	broken by an interrupt.  Use the functions above for pins only known at run time.
+*/
+
+/*PINx, DDRx and PORTx of port A..D sit 3 bytes apart, going down from port A*/
+#define DIO_PIN_REG(PIN)			(*((volatile u8 *)(0x39 - (3 * ((PIN) / 8)))))
+#define DIO_DDR_REG(PIN)			(*((volatile u8 *)(0x3A - (3 * ((PIN) / 8)))))
+#define DIO_PORT_REG(PIN)			(*((volatile u8 *)(0x3B - (3 * ((PIN) / 8)))))
+
+#define DIO_SET_PIN(PIN)			SET_BIT(DIO_PORT_REG(PIN),((PIN) % 8))
+#define DIO_CLR_PIN(PIN)			CLR_BIT(DIO_PORT_REG(PIN),((PIN) % 8))
+#define DIO_WRITE_PIN(PIN,LOGIC)	do{ if(LOW != (LOGIC)){ DIO_SET_PIN(PIN); } else{ DIO_CLR_PIN(PIN); } }while(0)
+#define DIO_READ_PIN(PIN)			((Logic_TYPE)READ_BIT(DIO_PIN_REG(PIN),((PIN) % 8)))
+/*Same pull up / output low handling as DIO_voidSetPinDirection*/
+#define DIO_SET_PIN_DIRECTION(PIN,MODE)	do{ \
+		if(OUTPUT == (MODE)){ SET_BIT(DIO_DDR_REG(PIN),((PIN) % 8)); DIO_CLR_PIN(PIN); } \
+		else if(INPULL == (MODE)){ CLR_BIT(DIO_DDR_REG(PIN),((PIN) % 8)); DIO_SET_PIN(PIN); } \
+		else{ CLR_BIT(DIO_DDR_REG(PIN),((PIN) % 8)); DIO_CLR_PIN(PIN); } \
+	}while(0)
 
 
 
@@ -25,6 +25,13 @@
 #define DDRD	(*((volatile u8 *)0x31))
 #define PORTD	(*((volatile u8 *)0x32))
 
+#define SREG	(*((volatile u8 *)0x5F))
+
+/*The masked port operations run with interrupts disabled, so an ISR changing other pins
+  of the same port between the read and the write can not be undone by it*/
+#define DIO_ATOMIC_BEGIN(SAVED_SREG)	do{ (SAVED_SREG) = SREG; __asm__ __volatile__("cli" ::: "memory"); }while(0)
+#define DIO_ATOMIC_END(SAVED_SREG)		do{ __asm__ __volatile__("" ::: "memory"); SREG = (SAVED_SREG); }while(0)
+
 
 extern PIN_TYPE DIO_Pin_Array[PIN_TOTAL_NUMBER];
 
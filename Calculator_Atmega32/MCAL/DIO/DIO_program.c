@@ -11,6 +11,10 @@
 #include "DIO_interface.h"
 #include "DIO_private.h"
 
+/*Registers of each port, indexed by PORT_TYPE, for the masked port operations*/
+static volatile u8 * const DIO_pu8PortReg[] = {&PORTA,&PORTB,&PORTC,&PORTD};
+static volatile u8 * const DIO_pu8PinReg[]  = {&PINA,&PINB,&PINC,&PIND};
+
 
 
 
@@ -200,3 +204,44 @@ void DIO_voidWritePort(PORT_TYPE Copy_xPort, u8 Copy_u8Value)
 		break;
 	}	
 }
+/*Only the bits set in the mask are changed, with one read and one write of the port*/
+void DIO_voidWritePortMasked(PORT_TYPE Copy_xPort, u8 Copy_u8Mask, u8 Copy_u8Value)
+{
+	u8 Local_u8Sreg;
+	volatile u8 *Local_pu8Port = DIO_pu8PortReg[Copy_xPort];
+	Copy_u8Value &= Copy_u8Mask;
+	DIO_ATOMIC_BEGIN(Local_u8Sreg);
+	*Local_pu8Port = (*Local_pu8Port & ~Copy_u8Mask) | Copy_u8Value;
+	DIO_ATOMIC_END(Local_u8Sreg);
+}
+void DIO_voidSetPortMask(PORT_TYPE Copy_xPort, u8 Copy_u8Mask)
+{
+	u8 Local_u8Sreg;
+	volatile u8 *Local_pu8Port = DIO_pu8PortReg[Copy_xPort];
+	DIO_ATOMIC_BEGIN(Local_u8Sreg);
+	*Local_pu8Port |= Copy_u8Mask;
+	DIO_ATOMIC_END(Local_u8Sreg);
+}
+void DIO_voidClearPortMask(PORT_TYPE Copy_xPort, u8 Copy_u8Mask)
+{
+	u8 Local_u8Sreg;
+	volatile u8 *Local_pu8Port = DIO_pu8PortReg[Copy_xPort];
+	DIO_ATOMIC_BEGIN(Local_u8Sreg);
+	*Local_pu8Port &= ~Copy_u8Mask;
+	DIO_ATOMIC_END(Local_u8Sreg);
+}
+/*The ATmega32 PINx registers are read only (no write to toggle), so this is a read
+  modify write of PORTx like the others*/
+void DIO_voidTogglePortMask(PORT_TYPE Copy_xPort, u8 Copy_u8Mask)
+{
+	u8 Local_u8Sreg;
+	volatile u8 *Local_pu8Port = DIO_pu8PortReg[Copy_xPort];
+	DIO_ATOMIC_BEGIN(Local_u8Sreg);
+	*Local_pu8Port ^= Copy_u8Mask;
+	DIO_ATOMIC_END(Local_u8Sreg);
+}
+/*All the masked pins are sampled by the same read of PINx*/
+u8 DIO_u8ReadPortMasked(PORT_TYPE Copy_xPort, u8 Copy_u8Mask)
+{
+	return (*DIO_pu8PinReg[Copy_xPort]) & Copy_u8Mask;
+}
@@ -0,0 +1,29 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: TIMER configuration file   ******************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef TIMER_CNFIG_H_
+#define TIMER_CNFIG_H_
+
+/**
+*	Options:
+			TIMER2_PRESCALER_1
+			TIMER2_PRESCALER_8
+			TIMER2_PRESCALER_32
+			TIMER2_PRESCALER_64
+			TIMER2_PRESCALER_128
+			TIMER2_PRESCALER_256
+			TIMER2_PRESCALER_1024
+*/
+#define TIMER2_PRESCALER		TIMER2_PRESCALER_8
+
+/*Interrupt every (TIMER2_COMPARE_VALUE + 1) timer counts, 100 * 0.5us = 50us at 16MHz
+  with prescaler 8 (the LCD engine relies on this, see LCD_ENGINE_TICK_US)*/
+#define TIMER2_COMPARE_VALUE	99
+
+
+#endif /* TIMER_CNFIG_H_ */
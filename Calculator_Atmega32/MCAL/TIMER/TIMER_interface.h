@@ -0,0 +1,37 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: TIMER Functions interface file   ************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef TIMER_INTERFACE_H_
+#define TIMER_INTERFACE_H_
+
+#include "StdTypes.h"
+
+/*Timer 0 and timer 1 belong to the RTOS port (run time stats clock and tick), only
+  timer 2 is driven from here*/
+
+/**
+* @brief: start timer 2 in clear on compare match mode, with the prescaler and compare
+*		  value of TIMER_cnfig.h.  The compare interrupt is left disabled.
+*/
+extern void TIMER2_voidInit(void);
+/**
+* @brief: enable the timer 2 compare match interrupt.
+*/
+extern void TIMER2_voidEnableInterrupt(void);
+/**
+* @brief: disable the timer 2 compare match interrupt.
+*/
+extern void TIMER2_voidDisableInterrupt(void);
+/**
+* @brief: set the function called from the timer 2 compare match interrupt.
+* @Param: Copy_pvCallBack	function to be called, NULL_PTR for none.
+*/
+extern void TIMER2_voidSetCallBack(void (*Copy_pvCallBack)(void));
+
+
+#endif /* TIMER_INTERFACE_H_ */
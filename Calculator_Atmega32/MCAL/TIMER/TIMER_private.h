@@ -0,0 +1,38 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: TIMER Private header file   *****************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef TIMER_PRIVATE_H_
+#define TIMER_PRIVATE_H_
+
+#define TCCR2	(*((volatile u8 *)0x45))
+#define TCNT2	(*((volatile u8 *)0x44))
+#define OCR2	(*((volatile u8 *)0x43))
+/*TIMSK and TIFR are shared with timer 0 and timer 1*/
+#define TIMSK	(*((volatile u8 *)0x59))
+#define TIFR	(*((volatile u8 *)0x58))
+
+/*TCCR2 bits*/
+#define WGM21	3
+/*TIMSK bits*/
+#define OCIE2	7
+/*TIFR bits*/
+#define OCF2	7
+
+/*TCCR2 clock select values*/
+#define TIMER2_PRESCALER_1		1
+#define TIMER2_PRESCALER_8		2
+#define TIMER2_PRESCALER_32		3
+#define TIMER2_PRESCALER_64		4
+#define TIMER2_PRESCALER_128	5
+#define TIMER2_PRESCALER_256	6
+#define TIMER2_PRESCALER_1024	7
+
+/*Timer 2 compare match vector*/
+void __vector_4(void) __attribute__((signal));
+
+#endif /* TIMER_PRIVATE_H_ */
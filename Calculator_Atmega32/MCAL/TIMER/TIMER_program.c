@@ -0,0 +1,45 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Description: TIMER Functions implementation file   *******/
+/***************************************************************************************/
+/***************************************************************************************/
+#include "StdTypes.h"
+#include "Utiles.h"
+
+#include "TIMER_interface.h"
+#include "TIMER_private.h"
+#include "TIMER_cnfig.h"
+
+static void (*TIMER2_pvCallBack)(void) = NULL_PTR;
+
+void TIMER2_voidInit(void)
+{
+	CLR_BIT(TIMSK,OCIE2);
+	TCNT2 = 0;
+	OCR2 = TIMER2_COMPARE_VALUE;
+	/*Clear any match that happened before the compare value was set*/
+	TIFR = (MASK<<OCF2);
+	TCCR2 = (MASK<<WGM21) | TIMER2_PRESCALER;
+}
+void TIMER2_voidEnableInterrupt(void)
+{
+	SET_BIT(TIMSK,OCIE2);
+}
+void TIMER2_voidDisableInterrupt(void)
+{
+	CLR_BIT(TIMSK,OCIE2);
+}
+void TIMER2_voidSetCallBack(void (*Copy_pvCallBack)(void))
+{
+	TIMER2_pvCallBack = Copy_pvCallBack;
+}
+
+void __vector_4(void)
+{
+	if(NULL_PTR != TIMER2_pvCallBack)
+	{
+		TIMER2_pvCallBack();
+	}
+}
@@ -0,0 +1,22 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: UART configuration file   *******************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef UART_CNFIG_H_
+#define UART_CNFIG_H_
+
+/**
+*	Options (error at 16MHz):
+			9600UL		(0.2%)
+			38400UL		(0.2%)
+			57600UL		(0.8%)
+			115200UL	(2.1%)
+*/
+#define UART_BAUD_RATE	57600UL
+
+
+#endif /* UART_CNFIG_H_ */
@@ -0,0 +1,26 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: UART Functions interface file   *************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef UART_INTERFACE_H_
+#define UART_INTERFACE_H_
+
+#include "StdTypes.h"
+
+/**
+* @brief: enable the transmitter, 8 data bits, no parity, 1 stop bit at
+*		  UART_BAUD_RATE (see UART_cnfig.h).
+*/
+extern void UART_voidInit(void);
+/**
+* @brief: wait until the transmit buffer is empty then send one byte.
+* @Param: Copy_u8Data	byte to be sent.
+*/
+extern void UART_voidSendByte(u8 Copy_u8Data);
+
+
+#endif /* UART_INTERFACE_H_ */
@@ -0,0 +1,34 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: UART Private header file   ******************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef UART_PRIVATE_H_
+#define UART_PRIVATE_H_
+
+#define UDR		(*((volatile u8 *)0x2C))
+#define UCSRA	(*((volatile u8 *)0x2B))
+#define UCSRB	(*((volatile u8 *)0x2A))
+#define UBRRL	(*((volatile u8 *)0x29))
+/*UCSRC and UBRRH share one address, URSEL selects UCSRC on write*/
+#define UCSRC	(*((volatile u8 *)0x40))
+#define UBRRH	(*((volatile u8 *)0x40))
+
+/*UCSRA bits*/
+#define UDRE	5
+#define U2X		1
+/*UCSRB bits*/
+#define TXEN	3
+/*UCSRC bits*/
+#define URSEL	7
+#define UCSZ1	2
+#define UCSZ0	1
+
+/*Double speed mode divides by 8 rather than 16, which keeps the error of the
+  common baud rates low at 16MHz*/
+#define UART_UBRR_VALUE	((u16)(((F_CPU) / (8UL * (UART_BAUD_RATE))) - 1UL))
+
+#endif /* UART_PRIVATE_H_ */
@@ -0,0 +1,29 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Description: UART Functions implementation file   ********/
+/***************************************************************************************/
+/***************************************************************************************/
+#include "StdTypes.h"
+#include "Utiles.h"
+
+#include "UART_interface.h"
+#include "UART_private.h"
+#include "UART_cnfig.h"
+
+
+void UART_voidInit(void)
+{
+	UBRRH = (u8)(UART_UBRR_VALUE >> 8);
+	UBRRL = (u8)UART_UBRR_VALUE;
+	SET_BIT(UCSRA,U2X);
+	/*8 data bits, no parity, 1 stop bit*/
+	UCSRC = (MASK<<URSEL) | (MASK<<UCSZ1) | (MASK<<UCSZ0);
+	SET_BIT(UCSRB,TXEN);
+}
+void UART_voidSendByte(u8 Copy_u8Data)
+{
+	while(0 == READ_BIT(UCSRA,UDRE));
+	UDR = Copy_u8Data;
+}
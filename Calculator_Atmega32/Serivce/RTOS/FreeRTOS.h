@@ -696,6 +696,10 @@ extern "C" {
 	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )
 #endif
 
+#ifndef configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING
+	#define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
+#endif
+
 #ifndef configEXPECTED_IDLE_TIME_BEFORE_SLEEP
 	#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP 2
 #endif
@@ -720,6 +724,10 @@ extern "C" {
 	#define configUSE_QUEUE_SETS 0
 #endif
 
+#ifndef configUSE_QUEUE_COPY_ROUTINES
+	#define configUSE_QUEUE_COPY_ROUTINES 0
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
 	#define portTASK_USES_FLOATING_POINT()
 #endif
@@ -760,6 +768,14 @@ extern "C" {
 	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
 #endif
 
+#ifndef configUSE_DELAYED_TASK_WHEEL
+	#define configUSE_DELAYED_TASK_WHEEL 0
+#endif
+
+#ifndef configDELAYED_TASK_WHEEL_BITS
+	#define configDELAYED_TASK_WHEEL_BITS 2
+#endif
+
 #ifndef configAPPLICATION_ALLOCATED_HEAP
 	#define configAPPLICATION_ALLOCATED_HEAP 0
 #endif
@@ -772,6 +788,20 @@ extern "C" {
 	#define portTICK_TYPE_IS_ATOMIC 0
 #endif
 
+#ifndef configUSE_STREAM_BUFFERS
+	#define configUSE_STREAM_BUFFERS 0
+#endif
+
+#ifndef configUSE_MESSAGE_POOLS
+	#define configUSE_MESSAGE_POOLS 0
+#endif
+
+#ifndef portMEMORY_BARRIER
+	/* Stops the compiler moving memory accesses across it, needed where
+	stream_buffer.c publishes an index that guards data. */
+	#define portMEMORY_BARRIER()
+#endif
+
 #ifndef configSUPPORT_STATIC_ALLOCATION
 	/* Defaults to 0 for backward compatibility. */
 	#define configSUPPORT_STATIC_ALLOCATION 0
@@ -793,6 +823,12 @@ extern "C" {
 	#error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, but can both be 1.
 #endif
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+	#if( ( configDELAYED_TASK_WHEEL_BITS != 1 ) && ( configDELAYED_TASK_WHEEL_BITS != 2 ) && ( configDELAYED_TASK_WHEEL_BITS != 4 ) )
+		#error configDELAYED_TASK_WHEEL_BITS must be 1, 2 or 4 so the wheel levels exactly cover TickType_t
+	#endif
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 #if( ( configUSE_RECURSIVE_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
@@ -969,6 +1005,10 @@ typedef struct xSTATIC_QUEUE
 {
 	void *pvDummy1[ 3 ];
 
+	#if ( configUSE_QUEUE_COPY_ROUTINES == 1 )
+		void *pvDummy1a;
+	#endif
+
 	union
 	{
 		void *pvDummy2;
@@ -995,6 +1035,9 @@ typedef struct xSTATIC_QUEUE
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
+/* A message pool is a queue of free blocks, see message_pool.h. */
+typedef StaticQueue_t StaticMessagePool_t;
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1055,6 +1098,30 @@ typedef struct xSTATIC_TIMER
 
 } StaticTimer_t;
 
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the stream buffer structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a stream buffer then the size of the stream buffer object needs to be
+ * know.  The StaticStreamBuffer_t structure below is provided for this purpose.
+ * Its size and alignment requirements are guaranteed to match those of the
+ * genuine structure, no matter which architecture is being used, and no matter
+ * how the values in FreeRTOSConfig.h are set.  Its contents are somewhat
+ * obfuscated in the hope users will recognise that it would be unwise to make
+ * direct use of the structure members.
+ */
+typedef struct xSTATIC_STREAM_BUFFER
+{
+	UBaseType_t uxDummy1[ 6 ];
+	void * pvDummy2[ 3 ];
+	uint8_t ucDummy3;
+} StaticStreamBuffer_t;
+
+/* Message buffers are built on stream buffers. */
+typedef StaticStreamBuffer_t StaticMessageBuffer_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -83,17 +83,33 @@
  *----------------------------------------------------------*/
 
 #define configCPU_CLOCK_HZ              16000000ul
-#define configUSE_TICKLESS_IDLE         0
+#define configUSE_TICKLESS_IDLE         1
 #define configTICK_RATE_HZ              ( ( TickType_t ) 1000 )
 
 #define configUSE_PREEMPTION				1
-#define configUSE_IDLE_HOOK					0
-#define configUSE_TICK_HOOK					0
+/* The idle task hook runs the co-routines. */
+#define configUSE_IDLE_HOOK					1
+/* The tick hook scans the keypad. */
+#define configUSE_TICK_HOOK					1
 #define configMAX_PRIORITIES				( 7 )
-#define configMINIMAL_STACK_SIZE			( ( unsigned short ) 80 )
+/* Also the stack every co-routine runs on, as they run in the idle task. */
+#define configMINIMAL_STACK_SIZE			( ( unsigned short ) 140 )
+/* The tick interrupt and context switches run on their own stack, see port.c.
+Driver interrupts that do not use portRUN_ON_ISR_STACK(), such as the LCD
+engine's, still land on whichever task stack they interrupt, so the task stacks
+keep their sizes from before this option until measured on the target. */
+#define configUSE_ISR_STACK					1
+#define configISR_STACK_SIZE				128
 #define configTOTAL_HEAP_SIZE				( ( size_t ) ( 1550 ) )
 #define configMAX_TASK_NAME_LEN				( 10 )
 #define configUSE_TRACE_FACILITY			0
+/* Timer 0 at the tick timer's prescale, so run times are in 4us counts rather
+than 1us.  It is stopped and caught up across tickless sleeps, see port.c. */
+#define configGENERATE_RUN_TIME_STATS		1
+/* Binary scheduler trace, see Serivce/Trace.  Needs configUSE_TRACE_FACILITY,
+configGENERATE_RUN_TIME_STATS and configUSE_IDLE_HOOK set to 1, takes the UART
+and TRACE_BUFFER_RECORDS * 4 bytes of RAM. */
+#define configUSE_TRACE_RECORDER			0
 #define configUSE_16_BIT_TICKS				1
 #define configIDLE_SHOULD_YIELD				1
 #define configUSE_MUTEXES					1
@@ -103,18 +119,46 @@
 #define configUSE_MALLOC_FAILED_HOOK		0
 #define configUSE_APPLICATION_TASK_TAG		0
 #define configUSE_TIME_SLICING				1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION	1
+/* Delayed tasks in a timing wheel rather than a sorted list.  Costs
+( 16 / configDELAYED_TASK_WHEEL_BITS ) << configDELAYED_TASK_WHEEL_BITS lists
+of RAM, 32 lists with 2 bits. */
+#define configUSE_DELAYED_TASK_WHEEL		0
+#define configDELAYED_TASK_WHEEL_BITS		2
 #define INCLUDE_uxTaskGetStackHighWaterMark	1
-#define configSUPPORT_STATIC_ALLOCATION		0
+/* Every kernel object is created from static memory in main.c, heap_2.c builds
+to nothing and configTOTAL_HEAP_SIZE is unused. */
+#define configSUPPORT_STATIC_ALLOCATION		1
+#define configSUPPORT_DYNAMIC_ALLOCATION	0
 #define configUSE_COUNTING_SEMAPHORES       1
-/* Co-routine definitions. */
-#define configUSE_CO_ROUTINES           0
+/* LCD_vTask blocks on one set holding all its inputs, see main.c.  A set
+costs one queue plus a pointer per event it can hold. */
+#define configUSE_QUEUE_SETS				1
+/* Copy queue items with routines picked for the item size instead of
+memcpy(), see queue.c.  It costs a pointer per queue and an indirect call and
+is not measured on the ATmega32 yet, so it stays off.  Tools/QueueBench builds
+with it set both ways. */
+#ifndef configUSE_QUEUE_COPY_ROUTINES
+	#define configUSE_QUEUE_COPY_ROUTINES	0
+#endif
+/* Lock free single writer, single reader stream and message buffers, see
+stream_buffer.h.  Nothing uses them yet, set to 1 to build stream_buffer.c. */
+#define configUSE_STREAM_BUFFERS			0
+/* Fixed block pools for passing messages by reference, see message_pool.h.
+The messages here are a few bytes, smaller than a pool's own overhead, so
+they are still copied through their queues. */
+#define configUSE_MESSAGE_POOLS				0
+/* Co-routine definitions.  The CALC and TIMER jobs are co-routines, see
+main.c. */
+#define configUSE_CO_ROUTINES           1
 #define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
 
-/* Software timer definitions. */
-#define configUSE_TIMERS                0
+/* Software timer definitions.  Each command queue slot is a 9 byte message on
+the AVR, only the inactivity timer sends commands so two slots are enough. */
+#define configUSE_TIMERS                1
 #define configTIMER_TASK_PRIORITY       ( configMAX_PRIORITIES - 1 )
-#define configTIMER_QUEUE_LENGTH        5
-#define configTIMER_TASK_STACK_DEPTH    ( configMINIMAL_STACK_SIZE * 2 )
+#define configTIMER_QUEUE_LENGTH        2
+#define configTIMER_TASK_STACK_DEPTH    ( ( unsigned short ) 160 )
 
 /* Set the following definitions to 1 to include the API function, or zero
 to exclude the API function. */
@@ -125,6 +169,7 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend            1
 #define INCLUDE_vTaskDelayUntil         1
 #define INCLUDE_vTaskDelay              1
+#define INCLUDE_xTimerPendFunctionCall  1
 
 
 /* The highest interrupt priority that can be used by any interrupt service
@@ -145,8 +190,14 @@ placed into the low power state respectively.  The empty implementations
 provided in this demo can be extended to save even more power. */
 //void vPreSleepProcessing( unsigned long xExpectedIdleTime );
 //void vPostSleepProcessing( unsigned long xExpectedIdleTime );
-#define configPRE_SLEEP_PROCESSING( xExpectedIdleTime ) vPreSleepProcessing( xExpectedIdleTime );
-#define configPOST_SLEEP_PROCESSING( xExpectedIdleTime ) vPostSleepProcessing( xExpectedIdleTime );
+/* The keypad is scanned from the tick hook, which does not run for suppressed
+ticks, so every sleep ends in time for the next scan.  See main.c.  Spelled
+as in main.c, tasks.c sees this declaration and not main.h. */
+#include <stdint.h>
+extern uint16_t KeyPad_u16LimitIdleTime( uint16_t Copy_u16ExpectedIdleTime );
+#define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime )	( xExpectedIdleTime ) = KeyPad_u16LimitIdleTime( xExpectedIdleTime )
+#define configPRE_SLEEP_PROCESSING( xExpectedIdleTime )
+#define configPOST_SLEEP_PROCESSING( xExpectedIdleTime )
 
 /* Definitions that map the FreeRTOS port interrupt handlers to their CMSIS
 standard names. */
@@ -154,5 +205,11 @@ standard names. */
 //#define xPortPendSVHandler PendSV_Handler
 //#define xPortSysTickHandler SysTick_Handler
 
+/* The trace hooks must be defined before FreeRTOS.h provides the empty
+defaults. */
+#if configUSE_TRACE_RECORDER == 1
+	#include "Trace_interface.h"
+#endif
+
 #endif /* FREERTOS_CONFIG_H */
 
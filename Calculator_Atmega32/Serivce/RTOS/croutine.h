@@ -170,7 +170,37 @@ typedef struct corCoRoutineControlBlock
  * \defgroup xCoRoutineCreate xCoRoutineCreate
  * \ingroup Tasks
  */
-BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex );
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex );
+#endif
+
+/**
+ * croutine. h
+ *<pre>
+ BaseType_t xCoRoutineCreateStatic(
+                                 crCOROUTINE_CODE pxCoRoutineCode,
+                                 UBaseType_t uxPriority,
+                                 UBaseType_t uxIndex,
+                                 CRCB_t *pxCoRoutineBuffer
+                               );</pre>
+ *
+ * As xCoRoutineCreate(), but the co-routine control block is provided by the
+ * application in pxCoRoutineBuffer rather than allocated from the FreeRTOS
+ * heap.  Co-routines have no stack of their own so the control block is the
+ * only memory a co-routine needs.
+ *
+ * @param pxCoRoutineBuffer Must point to a CRCB_t variable that stays in scope
+ * for as long as the co-routine exists - normally a file scope variable.
+ *
+ * @return pdPASS if the co-routine was added to a ready list, otherwise
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY if pxCoRoutineBuffer is NULL.
+ *
+ * \defgroup xCoRoutineCreateStatic xCoRoutineCreateStatic
+ * \ingroup Tasks
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	BaseType_t xCoRoutineCreateStatic( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex, CRCB_t *pxCoRoutineBuffer );
+#endif
 
 
 /**
@@ -755,6 +785,18 @@ void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay, List_t *pxEventList )
  */
 BaseType_t xCoRoutineRemoveFromEventList( const List_t *pxEventList );
 
+/*
+ * This function is intended for internal use by the idle task only.  The
+ * function should not be used by application writers.
+ *
+ * Returns the number of ticks before a co-routine next needs to run, so the
+ * tickless idle sleep does not stretch past a co-routine delay.  0 if a
+ * co-routine is ready now, portMAX_DELAY if none are delayed.
+ */
+#if( configUSE_TICKLESS_IDLE != 0 )
+	TickType_t xCoRoutineGetExpectedIdleTime( void );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,250 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "message_pool.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include message pools.  This #if is closed at the very bottom of this file.
+If you want to include message pools then ensure configUSE_MESSAGE_POOLS is set
+to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_MESSAGE_POOLS == 1 )
+
+/*
+ * Puts the address of each of the uxBlockCount blocks of pucBlockStorage on
+ * the free list of a newly created pool.
+ */
+static void prvInitialiseNewMessagePool( MessagePoolHandle_t xMessagePool, const UBaseType_t uxBlockCount, const size_t xBlockSize, uint8_t *pucBlockStorage ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	MessagePoolHandle_t xMessagePoolCreate( const UBaseType_t uxBlockCount, const size_t xBlockSize )
+	{
+	MessagePoolHandle_t xMessagePool;
+	uint8_t *pucBlockStorage;
+
+		configASSERT( uxBlockCount > ( UBaseType_t ) 0 );
+		configASSERT( xBlockSize > ( size_t ) 0 );
+
+		xMessagePool = xQueueCreate( uxBlockCount, sizeof( void * ) );
+
+		if( xMessagePool != NULL )
+		{
+			pucBlockStorage = ( uint8_t * ) pvPortMalloc( ( size_t ) uxBlockCount * xBlockSize );
+
+			if( pucBlockStorage != NULL )
+			{
+				prvInitialiseNewMessagePool( xMessagePool, uxBlockCount, xBlockSize, pucBlockStorage );
+			}
+			else
+			{
+				vQueueDelete( xMessagePool );
+				xMessagePool = NULL;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xMessagePool;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	MessagePoolHandle_t xMessagePoolCreateStatic( const UBaseType_t uxBlockCount, const size_t xBlockSize, uint8_t *pucBlockStorage, uint8_t *pucFreeListStorage, StaticMessagePool_t *pxStaticMessagePool )
+	{
+	MessagePoolHandle_t xMessagePool;
+
+		configASSERT( uxBlockCount > ( UBaseType_t ) 0 );
+		configASSERT( xBlockSize > ( size_t ) 0 );
+		configASSERT( pucBlockStorage );
+
+		xMessagePool = xQueueCreateStatic( uxBlockCount, sizeof( void * ), pucFreeListStorage, pxStaticMessagePool );
+
+		if( xMessagePool != NULL )
+		{
+			prvInitialiseNewMessagePool( xMessagePool, uxBlockCount, xBlockSize, pucBlockStorage );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xMessagePool;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void *pvMessagePoolAlloc( MessagePoolHandle_t xMessagePool, TickType_t xTicksToWait )
+{
+void *pvBlock;
+
+	configASSERT( xMessagePool );
+
+	if( xQueueReceive( xMessagePool, &pvBlock, xTicksToWait ) != pdPASS )
+	{
+		pvBlock = NULL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void *pvMessagePoolAllocFromISR( MessagePoolHandle_t xMessagePool, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+void *pvBlock;
+
+	configASSERT( xMessagePool );
+
+	if( xQueueReceiveFromISR( xMessagePool, &pvBlock, pxHigherPriorityTaskWoken ) != pdPASS )
+	{
+		pvBlock = NULL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+void vMessagePoolFree( MessagePoolHandle_t xMessagePool, void *pvBlock )
+{
+BaseType_t xReturn;
+
+	configASSERT( xMessagePool );
+	configASSERT( pvBlock );
+
+	/* The free list has room for every block of the pool, so it can only be
+	full if too many blocks were given back.  That only catches a block freed
+	twice, or given to the wrong pool, while every block is free.  Otherwise
+	the block goes on the free list twice and is handed out twice. */
+	xReturn = xQueueSendToBack( xMessagePool, &pvBlock, ( TickType_t ) 0 );
+	configASSERT( xReturn == pdPASS );
+	( void ) xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vMessagePoolFreeFromISR( MessagePoolHandle_t xMessagePool, void *pvBlock, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xReturn;
+
+	configASSERT( xMessagePool );
+	configASSERT( pvBlock );
+
+	xReturn = xQueueSendToBackFromISR( xMessagePool, &pvBlock, pxHigherPriorityTaskWoken );
+	configASSERT( xReturn == pdPASS );
+	( void ) xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewMessagePool( MessagePoolHandle_t xMessagePool, const UBaseType_t uxBlockCount, const size_t xBlockSize, uint8_t *pucBlockStorage )
+{
+UBaseType_t uxBlock;
+void *pvBlock;
+
+	/* The scheduler may not be running yet and nothing can wait on the pool,
+	so the blocks are put on the free list without blocking. */
+	for( uxBlock = ( UBaseType_t ) 0; uxBlock < uxBlockCount; uxBlock++ )
+	{
+		pvBlock = ( void * ) pucBlockStorage;
+		( void ) xQueueSendToBack( xMessagePool, &pvBlock, ( TickType_t ) 0 );
+		pucBlockStorage += xBlockSize;
+	}
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include message pools.  If you want to include message pools then ensure
+configUSE_MESSAGE_POOLS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_MESSAGE_POOLS == 1 */
@@ -0,0 +1,217 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Message pools let messages be passed by reference.  A pool is a number of
+ * fixed size blocks.  The producer takes a block from the pool, fills it in
+ * place and sends only its address through an ordinary queue (whose item size
+ * is sizeof( void * )).  The consumer uses the block where it is and gives it
+ * back to the pool.  Each message is so written once and read once, however
+ * big it is, and the queues between producer and consumer only hold pointers.
+ *
+ * The pool is itself a queue holding the addresses of the free blocks, so a
+ * task can block until a block is freed and the ISR versions follow the queue
+ * rules.  A pool costs a queue, a pointer per block and the blocks, which only
+ * pays off once messages are larger than a few pointers.
+ */
+
+#ifndef MESSAGE_POOL_H
+#define MESSAGE_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include message_pool.h"
+#endif
+
+#include "queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Type by which message pools are referenced.  For example, a call to
+ * xMessagePoolCreate() returns an MessagePoolHandle_t variable that can then
+ * be used as a parameter to pvMessagePoolAlloc(), vMessagePoolFree(), etc.
+ */
+typedef QueueHandle_t MessagePoolHandle_t;
+
+/*
+ * The number of bytes the free list of a pool of uxBlockCount blocks takes,
+ * for sizing the pucFreeListStorage array passed to
+ * xMessagePoolCreateStatic().
+ */
+#define messagepoolFREE_LIST_SIZE( uxBlockCount ) ( ( size_t ) ( uxBlockCount ) * sizeof( void * ) )
+
+/**
+ * message_pool.h
+ *
+<pre>
+MessagePoolHandle_t xMessagePoolCreate( UBaseType_t uxBlockCount, size_t xBlockSize );
+</pre>
+ *
+ * Creates a pool of uxBlockCount blocks of xBlockSize bytes each, using
+ * dynamically allocated memory.  All the blocks start free.
+ *
+ * @return A handle to the created pool, or NULL if there was not enough heap
+ * for it.
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	MessagePoolHandle_t xMessagePoolCreate( const UBaseType_t uxBlockCount, const size_t xBlockSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * message_pool.h
+ *
+<pre>
+MessagePoolHandle_t xMessagePoolCreateStatic( UBaseType_t uxBlockCount,
+                                              size_t xBlockSize,
+                                              uint8_t *pucBlockStorage,
+                                              uint8_t *pucFreeListStorage,
+                                              StaticMessagePool_t *pxStaticMessagePool );
+</pre>
+ *
+ * Creates a pool of uxBlockCount blocks of xBlockSize bytes each, using
+ * statically allocated memory.  All the blocks start free.
+ *
+ * @param pucBlockStorage Must point to an array of at least
+ * uxBlockCount * xBlockSize bytes, the blocks themselves.  The blocks are
+ * handed out as they are laid out in this array, so xBlockSize must be a
+ * multiple of the alignment the messages need.
+ *
+ * @param pucFreeListStorage Must point to an array of at least
+ * messagepoolFREE_LIST_SIZE( uxBlockCount ) bytes.
+ *
+ * @param pxStaticMessagePool Must point to a variable of type
+ * StaticMessagePool_t, which will hold the pool's data structure.
+ *
+ * @return A handle to the created pool.
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	MessagePoolHandle_t xMessagePoolCreateStatic( const UBaseType_t uxBlockCount, const size_t xBlockSize, uint8_t *pucBlockStorage, uint8_t *pucFreeListStorage, StaticMessagePool_t *pxStaticMessagePool ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * message_pool.h
+ *
+<pre>
+void *pvMessagePoolAlloc( MessagePoolHandle_t xMessagePool, TickType_t xTicksToWait );
+void *pvMessagePoolAllocFromISR( MessagePoolHandle_t xMessagePool, BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Takes a free block from the pool.  The task version waits up to
+ * xTicksToWait for a block to be freed if there is none.  Co-routines must use
+ * a block time of 0.
+ *
+ * @param pxHigherPriorityTaskWoken As for xQueueReceiveFromISR(), can be NULL.
+ *
+ * @return The address of the block, or NULL if no block was free in time.
+ */
+void *pvMessagePoolAlloc( MessagePoolHandle_t xMessagePool, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void *pvMessagePoolAllocFromISR( MessagePoolHandle_t xMessagePool, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * message_pool.h
+ *
+<pre>
+void vMessagePoolFree( MessagePoolHandle_t xMessagePool, void *pvBlock );
+void vMessagePoolFreeFromISR( MessagePoolHandle_t xMessagePool, void *pvBlock, BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Gives a block taken with pvMessagePoolAlloc() back to the pool it was taken
+ * from.  It never blocks, the free list has room for every block.  A task
+ * waiting in pvMessagePoolAlloc() gets the block.
+ *
+ * Blocks are not tracked once handed out.  Freeing a block twice is only
+ * caught, by configASSERT(), if it overfills the free list.  Otherwise the
+ * block is later handed out twice.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if freeing the block
+ * unblocked a task that has a priority above the currently running task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  Can be NULL.
+ */
+void vMessagePoolFree( MessagePoolHandle_t xMessagePool, void *pvBlock ) PRIVILEGED_FUNCTION;
+void vMessagePoolFreeFromISR( MessagePoolHandle_t xMessagePool, void *pvBlock, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * message_pool.h
+ *
+<pre>
+UBaseType_t uxMessagePoolBlocksAvailable( MessagePoolHandle_t xMessagePool );
+</pre>
+ *
+ * @return The number of free blocks in the pool.
+ */
+#define uxMessagePoolBlocksAvailable( xMessagePool ) uxQueueMessagesWaiting( ( QueueHandle_t ) ( xMessagePool ) )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MESSAGE_POOL_H */
@@ -78,6 +78,7 @@ Changes from V2.6.0
 
 #include <stdlib.h>
 #include <avr/interrupt.h>
+#include <avr/sleep.h>
 
 #include "FreeRTOS.h"
 #include "task.h"
@@ -89,11 +90,29 @@ Changes from V2.6.0
 /* Start tasks with interrupts enables. */
 #define portFLAGS_INT_ENABLED					( ( StackType_t ) 0x80 )
 
+/* The last byte of a saved context says which registers are under it.  See
+portRESTORE_CONTEXT(). */
+#define portFULL_CONTEXT						( ( StackType_t ) 0x00 )
+#define portYIELD_CONTEXT						( ( StackType_t ) 0x01 )
+
 /* Hardware constants for timer 1. */
 #define portCLEAR_COUNTER_ON_MATCH				( ( uint8_t ) 0x08 )
 #define portPRESCALE_64							( ( uint8_t ) 0x03 )
 #define portCLOCK_PRESCALER						( ( uint32_t ) 64 )
 #define portCOMPARE_MATCH_A_INTERRUPT_ENABLE	( ( uint8_t ) 0x10 )
+#define portCOMPARE_MATCH_A_FLAG				( ( uint8_t ) 0x10 )
+
+/* Timer 1 counts in one tick period. */
+#define portTIMER_COUNTS_PER_TICK				( ( uint16_t ) ( ( configCPU_CLOCK_HZ / portCLOCK_PRESCALER ) / configTICK_RATE_HZ ) )
+
+/* The most ticks that can be suppressed before the 16 bit compare value
+overflows - 262 at 16MHz. */
+#define portMAX_SUPPRESSED_TICKS				( ( TickType_t ) ( 0xffffUL / portTIMER_COUNTS_PER_TICK ) )
+
+/* Timer 0 setup for the run time stats clock. */
+#define portTIMER0_PRESCALE_64					( ( uint8_t ) 0x03 )
+#define portTIMER0_OVERFLOW_INTERRUPT_ENABLE	( ( uint8_t ) 0x01 )
+#define portTIMER0_OVERFLOW_FLAG				( ( uint8_t ) 0x01 )
 
 /*-----------------------------------------------------------*/
 
@@ -118,6 +137,8 @@ extern volatile TCB_t * volatile pxCurrentTCB;
  * 
  * The interrupts will have been disabled during the call to portSAVE_CONTEXT()
  * so we need not worry about reading/writing to the stack pointer. 
+ *
+ * The cleared r1 is pushed last as the portFULL_CONTEXT marker.
  */
 
 #define portSAVE_CONTEXT()									\
@@ -157,6 +178,7 @@ extern volatile TCB_t * volatile pxCurrentTCB;
 					"push	r29						\n\t"	\
 					"push	r30						\n\t"	\
 					"push	r31						\n\t"	\
+					"push	r1						\n\t"	/* portFULL_CONTEXT. */ \
 					"lds	r26, pxCurrentTCB		\n\t"	\
 					"lds	r27, pxCurrentTCB + 1	\n\t"	\
 					"in		r0, 0x3d				\n\t"	\
@@ -165,9 +187,59 @@ extern volatile TCB_t * volatile pxCurrentTCB;
 					"st		x+, r0					\n\t"	\
 				);
 
+/*
+ * Macro to save the context of a task that is giving up the CPU by calling
+ * vPortYield(), the save the stack pointer into the TCB.
+ *
+ * The compiler treats r0, r18 to r27, r30, r31 and the flags other than I as
+ * clobbered by any function call, and r1 is zero on entry, so only SREG (for
+ * the I flag, which may be clear if the yield is in a critical section) and
+ * the call saved r2 to r17, r28 and r29 need saving.  That is 20 bytes
+ * against the 35 of portSAVE_CONTEXT(), and 20 pushes instead of 34.
+ *
+ * Only valid at a function call boundary, the tick interrupt still saves
+ * everything.
+ */
+
+#define portSAVE_CONTEXT_YIELD()							\
+	asm volatile (	"in		r0, __SREG__			\n\t"	\
+					"cli							\n\t"	\
+					"push	r0						\n\t"	\
+					"push	r2						\n\t"	\
+					"push	r3						\n\t"	\
+					"push	r4						\n\t"	\
+					"push	r5						\n\t"	\
+					"push	r6						\n\t"	\
+					"push	r7						\n\t"	\
+					"push	r8						\n\t"	\
+					"push	r9						\n\t"	\
+					"push	r10						\n\t"	\
+					"push	r11						\n\t"	\
+					"push	r12						\n\t"	\
+					"push	r13						\n\t"	\
+					"push	r14						\n\t"	\
+					"push	r15						\n\t"	\
+					"push	r16						\n\t"	\
+					"push	r17						\n\t"	\
+					"push	r28						\n\t"	\
+					"push	r29						\n\t"	\
+					"ldi	r18, %0					\n\t"	\
+					"push	r18						\n\t"	\
+					"lds	r26, pxCurrentTCB		\n\t"	\
+					"lds	r27, pxCurrentTCB + 1	\n\t"	\
+					"in		r0, 0x3d				\n\t"	\
+					"st		x+, r0					\n\t"	\
+					"in		r0, 0x3e				\n\t"	\
+					"st		x+, r0					\n\t"	\
+					:: "i" ( portYIELD_CONTEXT )			\
+				);
+
 /* 
- * Opposite to portSAVE_CONTEXT().  Interrupts will have been disabled during
- * the context save so we can write to the stack pointer. 
+ * Opposite to portSAVE_CONTEXT() and portSAVE_CONTEXT_YIELD().  Interrupts
+ * will have been disabled during the context save so we can write to the
+ * stack pointer.  The marker on top of the saved context selects which
+ * registers to pop.  Restoring a yield context clears r1 before SREG is
+ * written as clr changes the flags.
  */
 
 #define portRESTORE_CONTEXT()								\
@@ -177,6 +249,9 @@ extern volatile TCB_t * volatile pxCurrentTCB;
 					"out	__SP_L__, r28			\n\t"	\
 					"ld		r29, x+					\n\t"	\
 					"out	__SP_H__, r29			\n\t"	\
+					"pop	r0						\n\t"	\
+					"tst	r0						\n\t"	\
+					"brne	1f						\n\t"	\
 					"pop	r31						\n\t"	\
 					"pop	r30						\n\t"	\
 					"pop	r29						\n\t"	\
@@ -211,6 +286,30 @@ extern volatile TCB_t * volatile pxCurrentTCB;
 					"pop	r0						\n\t"	\
 					"out	__SREG__, r0			\n\t"	\
 					"pop	r0						\n\t"	\
+					"rjmp	2f						\n\t"	\
+					"1:								\n\t"	\
+					"pop	r29						\n\t"	\
+					"pop	r28						\n\t"	\
+					"pop	r17						\n\t"	\
+					"pop	r16						\n\t"	\
+					"pop	r15						\n\t"	\
+					"pop	r14						\n\t"	\
+					"pop	r13						\n\t"	\
+					"pop	r12						\n\t"	\
+					"pop	r11						\n\t"	\
+					"pop	r10						\n\t"	\
+					"pop	r9						\n\t"	\
+					"pop	r8						\n\t"	\
+					"pop	r7						\n\t"	\
+					"pop	r6						\n\t"	\
+					"pop	r5						\n\t"	\
+					"pop	r4						\n\t"	\
+					"pop	r3						\n\t"	\
+					"pop	r2						\n\t"	\
+					"pop	r0						\n\t"	\
+					"clr	r1						\n\t"	\
+					"out	__SREG__, r0			\n\t"	\
+					"2:								\n\t"	\
 				);
 
 /*-----------------------------------------------------------*/
@@ -221,6 +320,127 @@ extern volatile TCB_t * volatile pxCurrentTCB;
 static void prvSetupTimerInterrupt( void );
 /*-----------------------------------------------------------*/
 
+#if configUSE_TICKLESS_IDLE == 1
+
+	/* Set by the tick interrupt so vPortSuppressTicksAndSleep() can tell
+	whether the sleep was ended by the extended tick period expiring. */
+	static volatile BaseType_t xTickInterruptRan = pdFALSE;
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if configGENERATE_RUN_TIME_STATS == 1
+
+	/* Timer 0 runs free at the same prescale as the tick timer, one count
+	every 4us at 16MHz.  Its eight bits are extended to 32 by counting
+	overflows. */
+	volatile uint32_t ulPortRunTimeOverflows = 0UL;
+
+	/* Time spent in, and number of, tick interrupts.  These are file scope
+	rather than locals as vPortYieldFromTick() is naked so has no frame. */
+	static uint32_t ulTickInterruptEntryTime = 0UL;
+	static volatile uint32_t ulTickInterruptRunTime = 0UL;
+	static volatile uint32_t ulTickInterruptCount = 0UL;
+
+	/*
+	 * Add the time since ulTickInterruptEntryTime to the tick interrupt run
+	 * time.  Not inlined so the naked vPortYieldFromTick() does not need a
+	 * stack frame for the 32 bit arithmetic.
+	 */
+	static void prvAccountTickInterrupt( void ) __attribute__ ( ( noinline ) );
+
+	#if configUSE_TICKLESS_IDLE == 1
+
+		/*
+		 * Timer 0 overflows every 1.024ms, and each overflow interrupt would
+		 * end a tickless sleep.  It is stopped for the sleep, then moved on by
+		 * the number of counts timer 1, at the same prescale, measured.  Both
+		 * are called with interrupts disabled.
+		 */
+		static void prvStopRunTimeClock( void );
+		static void prvStartRunTimeClock( uint32_t ulSleptCounts );
+
+	#endif /* configUSE_TICKLESS_IDLE */
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
+#if configUSE_ISR_STACK == 1
+
+	/* The stack the tick interrupt, vPortYield() and portRUN_ON_ISR_STACK()
+	handlers run on.  Only one of them can use it at a time as interrupts are
+	disabled throughout, so each starts from the top. */
+	static StackType_t ucPortIsrStack[ configISR_STACK_SIZE ];
+
+	/* Set by portYIELD_FROM_ISR(), the switch is made by vPortRunOnIsrStack()
+	once it is back on the task stack. */
+	volatile BaseType_t xPortIsrYieldPending = pdFALSE;
+
+	/*
+	 * Move the stack pointer to the top of the interrupt stack.  Only used
+	 * once the current context has been saved, which leaves r26 and r27 free.
+	 */
+	#define portSWITCH_TO_ISR_STACK()																\
+		asm volatile (	"ldi	r26, lo8(%0)			\n\t"										\
+						"ldi	r27, hi8(%0)			\n\t"										\
+						"out	__SP_L__, r26			\n\t"										\
+						"out	__SP_H__, r27			\n\t"										\
+						:: "i" ( &ucPortIsrStack[ configISR_STACK_SIZE - 1 ] )					\
+					)
+
+#else
+
+	#define portSWITCH_TO_ISR_STACK()
+
+#endif /* configUSE_ISR_STACK */
+/*-----------------------------------------------------------*/
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+/*
+ * Tables used by the port optimised task selection macros in portmacro.h.
+ * ucPortHighestPriorityTable[ x ] is the index of the most significant set bit
+ * of x, so portGET_HIGHEST_PRIORITY() is a single lpm whatever the number of
+ * priorities.  Counted from the instruction timings at -Os, selecting a task
+ * when only the idle task is ready costs:
+ *
+ *                            configMAX_PRIORITIES = 7    configMAX_PRIORITIES = 8
+ *   generic list scan        ~13 cycles per empty        ~13 cycles per empty
+ *                            priority, up to ~88 total   priority, up to ~101 total
+ *   bit map + table          ~9 cycles                   ~9 cycles
+ *
+ * Recording and resetting a ready priority cost ~12 cycles each instead of the
+ * ~6 cycle compare of the generic path, but they are not executed on every
+ * tick.
+ */
+const uint8_t ucPortPriorityBitTable[ 8 ] PROGMEM =
+{
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
+const uint8_t ucPortHighestPriorityTable[ 256 ] PROGMEM =
+{
+	0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7
+};
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
 /* 
  * See header file for description. 
  */
@@ -333,6 +553,11 @@ uint16_t usAddress;
 	*pxTopOfStack = ( StackType_t ) 0x031;	/* R31 */
 	pxTopOfStack--;
 
+	/* A full context, as the task function takes its parameter in R24:R25,
+	which a yield context does not hold. */
+	*pxTopOfStack = portFULL_CONTEXT;
+	pxTopOfStack--;
+
 	/*lint +e950 +e611 +e923 */
 
 	return pxTopOfStack;
@@ -365,12 +590,15 @@ void vPortEndScheduler( void )
 
 /*
  * Manual context switch.  The first thing we do is save the registers so we
- * can use a naked attribute.
+ * can use a naked attribute.  As this is always called as a function only
+ * the call saved registers are saved.  The task being switched in may have
+ * been switched out by either a yield or a tick.
  */
 void vPortYield( void ) __attribute__ ( ( naked ) );
 void vPortYield( void )
 {
-	portSAVE_CONTEXT();
+	portSAVE_CONTEXT_YIELD();
+	portSWITCH_TO_ISR_STACK();
 	vTaskSwitchContext();
 	portRESTORE_CONTEXT();
 
@@ -388,16 +616,74 @@ void vPortYieldFromTick( void ) __attribute__ ( ( naked ) );
 void vPortYieldFromTick( void )
 {
 	portSAVE_CONTEXT();
+	portSWITCH_TO_ISR_STACK();
+	#if configGENERATE_RUN_TIME_STATS == 1
+	{
+		ulTickInterruptEntryTime = ulPortGetRunTimeCounterValue();
+	}
+	#endif
+	#if configUSE_TICKLESS_IDLE == 1
+	{
+		xTickInterruptRan = pdTRUE;
+	}
+	#endif
 	if( xTaskIncrementTick() != pdFALSE )
 	{
 		vTaskSwitchContext();
 	}
+	#if configGENERATE_RUN_TIME_STATS == 1
+	{
+		prvAccountTickInterrupt();
+	}
+	#endif
 	portRESTORE_CONTEXT();
 
 	asm volatile ( "ret" );
 }
 /*-----------------------------------------------------------*/
 
+#if configUSE_ISR_STACK == 1
+
+	/*
+	 * Called from a driver ISR to run pxHandler on the interrupt stack.  The
+	 * ISR prologue has already saved the call clobbered registers on the task
+	 * stack, so only the task stack pointer needs keeping, and that is pushed
+	 * onto the interrupt stack.  A context switch requested by the handler is
+	 * made by tail calling vPortYield() once back on the task stack.
+	 */
+	void vPortRunOnIsrStack( void ( *pxHandler )( void ) ) __attribute__ ( ( naked ) );
+	void vPortRunOnIsrStack( void ( *pxHandler )( void ) )
+	{
+		( void ) pxHandler;
+
+		asm volatile (	"in		r26, __SP_L__				\n\t"
+						"in		r27, __SP_H__				\n\t"
+						"ldi	r30, lo8(%0)				\n\t"
+						"ldi	r31, hi8(%0)				\n\t"
+						"out	__SP_L__, r30				\n\t"
+						"out	__SP_H__, r31				\n\t"
+						"push	r26							\n\t"
+						"push	r27							\n\t"
+						"movw	r30, r24					\n\t"
+						"icall								\n\t"
+						"pop	r27							\n\t"
+						"pop	r26							\n\t"
+						"out	__SP_L__, r26				\n\t"
+						"out	__SP_H__, r27				\n\t"
+						"lds	r24, xPortIsrYieldPending	\n\t"
+						"tst	r24							\n\t"
+						"breq	1f							\n\t"
+						"sts	xPortIsrYieldPending, r1	\n\t"
+						"jmp	vPortYield					\n\t"
+						"1:									\n\t"
+						"ret								\n\t"
+						:: "i" ( &ucPortIsrStack[ configISR_STACK_SIZE - 1 ] )
+					);
+	}
+
+#endif /* configUSE_ISR_STACK */
+/*-----------------------------------------------------------*/
+
 /*
  * Setup timer 1 compare match A to generate a tick interrupt.
  */
@@ -409,10 +695,8 @@ uint8_t ucHighByte, ucLowByte;
 	/* Using 16bit timer 1 to generate the tick.  Correct fuses must be
 	selected for the configCPU_CLOCK_HZ clock. */
 
-	ulCompareMatch = configCPU_CLOCK_HZ / configTICK_RATE_HZ;
-
 	/* We only have 16 bits so have to scale to get our required tick rate. */
-	ulCompareMatch /= portCLOCK_PRESCALER;
+	ulCompareMatch = portTIMER_COUNTS_PER_TICK;
 
 	/* Adjust for correct value. */
 	ulCompareMatch -= ( uint32_t ) 1;
@@ -460,9 +744,235 @@ uint8_t ucHighByte, ucLowByte;
 	void TIMER1_COMPA_vect( void ) __attribute__ ( ( signal ) );
 	void TIMER1_COMPA_vect( void )
 	{
+		#if configUSE_TICKLESS_IDLE == 1
+		{
+			xTickInterruptRan = pdTRUE;
+		}
+		#endif
 		xTaskIncrementTick();
 	}
 #endif
+/*-----------------------------------------------------------*/
+
+#if configUSE_TICKLESS_IDLE == 1
+
+	/*
+	 * Called by the idle task, with the scheduler suspended, when every task
+	 * is expected to stay blocked for at least xExpectedIdleTime ticks.  Timer
+	 * 1 is left running so no time is lost - the current tick period is just
+	 * stretched by moving the compare match out, and the CPU sleeps in idle
+	 * mode (the only mode that keeps timer 1 clocked) until either the
+	 * compare match or any other interrupt, such as a keypad or UART one,
+	 * wakes it.
+	 *
+	 * The AVR cannot wake from sleep with interrupts disabled, so the
+	 * interrupt that ends the sleep is serviced before this function
+	 * continues.  As the scheduler is suspended the tick interrupt only pends
+	 * its tick, and that pended tick is the last of the suppressed ticks.
+	 */
+	void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+	{
+	uint16_t usTimerCount;
+	TickType_t xCompleteTickPeriods;
+	#if configGENERATE_RUN_TIME_STATS == 1
+		uint16_t usSleepStartCount;
+		uint32_t ulSleptCounts;
+	#endif
+
+		/* The compare value is only 16 bits. */
+		if( xExpectedIdleTime > portMAX_SUPPRESSED_TICKS )
+		{
+			xExpectedIdleTime = portMAX_SUPPRESSED_TICKS;
+		}
+
+		portDISABLE_INTERRUPTS();
+
+		/* Don't sleep if a tick is already waiting to be processed, or if a
+		task was readied since the idle task decided to sleep. */
+		if( ( ( TIFR & portCOMPARE_MATCH_A_FLAG ) != 0 ) || ( eTaskConfirmSleepModeStatus() == eAbortSleep ) )
+		{
+			portENABLE_INTERRUPTS();
+		}
+		else
+		{
+			#if configGENERATE_RUN_TIME_STATS == 1
+			{
+				prvStopRunTimeClock();
+				usSleepStartCount = TCNT1;
+			}
+			#endif
+
+			/* TCNT1 counts from the last tick, so the compare match now
+			happens xExpectedIdleTime periods after that tick. */
+			OCR1A = ( uint16_t ) ( ( xExpectedIdleTime * portTIMER_COUNTS_PER_TICK ) - 1U );
+			xTickInterruptRan = pdFALSE;
+
+			/* The application can set xExpectedIdleTime to 0 to do its own
+			sleeping. */
+			configPRE_SLEEP_PROCESSING( xExpectedIdleTime );
+			if( xExpectedIdleTime > 0 )
+			{
+				set_sleep_mode( SLEEP_MODE_IDLE );
+				sleep_enable();
+
+				/* The instruction after sei is always executed before any
+				pending interrupt, so a wake up cannot be missed. */
+				asm volatile (	"sei		\n\t"
+								"sleep		\n\t" ::: "memory" );
+
+				sleep_disable();
+				portDISABLE_INTERRUPTS();
+			}
+			configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+			usTimerCount = TCNT1;
+
+			if( ( xTickInterruptRan != pdFALSE ) || ( ( TIFR & portCOMPARE_MATCH_A_FLAG ) != 0 ) )
+			{
+				/* The stretched period completed.  TCNT1 was cleared by the
+				compare match and the tick interrupt has either counted, or
+				will count when interrupts are enabled, the last tick. */
+				xCompleteTickPeriods = xExpectedIdleTime - ( TickType_t ) 1;
+				#if configGENERATE_RUN_TIME_STATS == 1
+				{
+					ulSleptCounts = ( ( uint32_t ) xExpectedIdleTime * portTIMER_COUNTS_PER_TICK ) - usSleepStartCount + usTimerCount;
+				}
+				#endif
+			}
+			else
+			{
+				/* Something else woke the CPU.  TCNT1 is the time since the
+				last tick. */
+				xCompleteTickPeriods = ( TickType_t ) 0;
+				#if configGENERATE_RUN_TIME_STATS == 1
+				{
+					ulSleptCounts = ( uint32_t ) ( usTimerCount - usSleepStartCount );
+				}
+				#endif
+			}
+
+			/* Whole tick periods in TCNT1 are counted here, the part period
+			is left in TCNT1 so the tick stays in phase. */
+			xCompleteTickPeriods += ( TickType_t ) ( usTimerCount / portTIMER_COUNTS_PER_TICK );
+			TCNT1 = usTimerCount % portTIMER_COUNTS_PER_TICK;
+			OCR1A = portTIMER_COUNTS_PER_TICK - 1U;
+
+			#if configGENERATE_RUN_TIME_STATS == 1
+			{
+				prvStartRunTimeClock( ulSleptCounts );
+			}
+			#endif
+
+			vTaskStepTick( xCompleteTickPeriods );
+			portENABLE_INTERRUPTS();
+		}
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
 
 
 	
+
+#if configGENERATE_RUN_TIME_STATS == 1
+
+	void vPortConfigureTimerForRunTimeStats( void )
+	{
+	uint8_t ucTimerMask;
+
+		/* Normal mode, so timer 0 counts 0 to 0xff then overflows.  Interrupts
+		are disabled when this is called from vTaskStartScheduler(). */
+		ulPortRunTimeOverflows = 0UL;
+		TCNT0 = 0;
+		TCCR0 = portTIMER0_PRESCALE_64;
+
+		ucTimerMask = TIMSK;
+		ucTimerMask |= portTIMER0_OVERFLOW_INTERRUPT_ENABLE;
+		TIMSK = ucTimerMask;
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t ulPortGetRunTimeCounterValue( void )
+	{
+	uint32_t ulOverflows;
+	uint8_t ucCount;
+
+		portENTER_CRITICAL();
+		{
+			ucCount = TCNT0;
+			ulOverflows = ulPortRunTimeOverflows;
+
+			/* An overflow since interrupts were disabled has not been counted
+			yet.  Read the timer again as it is not known whether the first
+			read was before or after the overflow - the second read is after
+			it. */
+			if( ( TIFR & portTIMER0_OVERFLOW_FLAG ) != 0 )
+			{
+				ucCount = TCNT0;
+				ulOverflows++;
+			}
+		}
+		portEXIT_CRITICAL();
+
+		return ( ulOverflows << 8 ) | ( uint32_t ) ucCount;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortGetTickInterruptStats( uint32_t *pulRunTime, uint32_t *pulCount )
+	{
+		portENTER_CRITICAL();
+		{
+			*pulRunTime = ulTickInterruptRunTime;
+			*pulCount = ulTickInterruptCount;
+		}
+		portEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvAccountTickInterrupt( void )
+	{
+		/* The time taken to save and restore the context is not included. */
+		ulTickInterruptRunTime += ulPortGetRunTimeCounterValue() - ulTickInterruptEntryTime;
+		ulTickInterruptCount++;
+	}
+	/*-----------------------------------------------------------*/
+
+	#if configUSE_TICKLESS_IDLE == 1
+
+		static void prvStopRunTimeClock( void )
+		{
+			TCCR0 = 0;
+
+			/* An overflow not serviced yet would end the sleep at once, so it
+			is counted here instead. */
+			if( ( TIFR & portTIMER0_OVERFLOW_FLAG ) != 0 )
+			{
+				TIFR = portTIMER0_OVERFLOW_FLAG;
+				ulPortRunTimeOverflows++;
+			}
+		}
+		/*-----------------------------------------------------------*/
+
+		static void prvStartRunTimeClock( uint32_t ulSleptCounts )
+		{
+		uint32_t ulCount;
+
+			ulCount = ( ( ulPortRunTimeOverflows << 8 ) | ( uint32_t ) TCNT0 ) + ulSleptCounts;
+			ulPortRunTimeOverflows = ulCount >> 8;
+			TCNT0 = ( uint8_t ) ulCount;
+			TCCR0 = portTIMER0_PRESCALE_64;
+		}
+		/*-----------------------------------------------------------*/
+
+	#endif /* configUSE_TICKLESS_IDLE */
+
+	/*
+	 * Extends timer 0 beyond eight bits.  Runs every 256 counts, 1.024ms at
+	 * 16MHz.
+	 */
+	void TIMER0_OVF_vect( void ) __attribute__ ( ( signal ) );
+	void TIMER0_OVF_vect( void )
+	{
+		ulPortRunTimeOverflows++;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
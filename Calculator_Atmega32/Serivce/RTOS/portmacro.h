@@ -135,6 +135,109 @@ typedef unsigned char UBaseType_t;
 /* Kernel utilities. */
 extern void vPortYield( void ) __attribute__ ( ( naked ) );
 #define portYIELD()					vPortYield()
+#define portMEMORY_BARRIER()		asm volatile ( "" ::: "memory" )
+/*-----------------------------------------------------------*/
+
+/* Tickless idle/low power functionality. */
+#if configUSE_TICKLESS_IDLE == 1
+	extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Run time stats clock, timer 0 extended to 32 bits in software.  See port.c. */
+#if configGENERATE_RUN_TIME_STATS == 1
+	extern void vPortConfigureTimerForRunTimeStats( void );
+	extern uint32_t ulPortGetRunTimeCounterValue( void );
+	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()	vPortConfigureTimerForRunTimeStats()
+	#define portGET_RUN_TIME_COUNTER_VALUE()			ulPortGetRunTimeCounterValue()
+
+	/* Total run time stats clock counts spent in the tick interrupt, and the
+	number of tick interrupts, since the scheduler started. */
+	extern void vPortGetTickInterruptStats( uint32_t *pulRunTime, uint32_t *pulCount );
+
+	/* The low 16 bits of the clock, read inline by callers that already have
+	interrupts disabled, such as the trace recorder.  They only need the low
+	byte of the overflow count. */
+	#include <avr/io.h>
+	extern volatile uint32_t ulPortRunTimeOverflows;
+	static inline uint16_t usPortGetRunTimeCounterLow( void ) __attribute__ ( ( always_inline ) );
+	static inline uint16_t usPortGetRunTimeCounterLow( void )
+	{
+	uint8_t ucCount = TCNT0;
+	uint8_t ucOverflows = *( ( volatile uint8_t * ) &ulPortRunTimeOverflows );
+
+		/* An overflow not counted yet, see ulPortGetRunTimeCounterValue(). */
+		if( ( TIFR & _BV( TOV0 ) ) != 0 )
+		{
+			ucCount = TCNT0;
+			ucOverflows++;
+		}
+		return ( uint16_t ) ( ( ( uint16_t ) ucOverflows << 8 ) | ucCount );
+	}
+#endif
+/*-----------------------------------------------------------*/
+
+/* Port optimised task selection.  uxTopReadyPriority is used as a bit map of
+the priorities that have ready tasks, so UBaseType_t limits the port to eight
+priorities.  The AVR has no count leading zeros instruction so the highest set
+bit is looked up in a 256 byte table held in flash.  See port.c. */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
+#endif
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+	#include <avr/pgmspace.h>
+
+	/* Check the configuration. */
+	#if( configMAX_PRIORITIES > 8 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 8.  There is no practical need to have more than 8 priorities on this port.
+	#endif
+
+	extern const uint8_t ucPortPriorityBitTable[ 8 ] PROGMEM;
+	extern const uint8_t ucPortHighestPriorityTable[ 256 ] PROGMEM;
+
+	/* Store/clear the ready priorities in a bit map.  The bit mask is also read
+	from flash as the AVR can only shift by one bit per instruction. */
+	#define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) |= pgm_read_byte( &( ucPortPriorityBitTable[ ( uxPriority ) ] ) )
+	#define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities ) ( uxReadyPriorities ) &= ~pgm_read_byte( &( ucPortPriorityBitTable[ ( uxPriority ) ] ) )
+
+	/*-----------------------------------------------------------*/
+
+	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) uxTopPriority = pgm_read_byte( &( ucPortHighestPriorityTable[ ( uxReadyPriorities ) ] ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
+/* Separate interrupt stack.  When configUSE_ISR_STACK is 1 the kernel code run
+by the tick interrupt and by vPortYield() runs on a configISR_STACK_SIZE byte
+stack of its own, so task stacks do not need to allow for it.  Driver ISRs put
+their handler on the same stack with portRUN_ON_ISR_STACK(), and must then
+request a context switch with portYIELD_FROM_ISR() rather than taskYIELD().
+Interrupts must stay disabled in any code that runs on the interrupt stack.
+See port.c. */
+#ifndef configUSE_ISR_STACK
+	#define configUSE_ISR_STACK 0
+#endif
+
+#if configUSE_ISR_STACK == 1
+
+	#ifndef configISR_STACK_SIZE
+		#error configISR_STACK_SIZE must be defined when configUSE_ISR_STACK is 1.
+	#endif
+
+	extern void vPortRunOnIsrStack( void ( *pxHandler )( void ) );
+	extern volatile BaseType_t xPortIsrYieldPending;
+	#define portRUN_ON_ISR_STACK( pxHandler )		vPortRunOnIsrStack( pxHandler )
+	#define portYIELD_FROM_ISR( xSwitchRequired )	if( ( xSwitchRequired ) != pdFALSE ) { xPortIsrYieldPending = pdTRUE; }
+
+#else
+
+	#define portRUN_ON_ISR_STACK( pxHandler )		( pxHandler )()
+	#define portYIELD_FROM_ISR( xSwitchRequired )	if( ( xSwitchRequired ) != pdFALSE ) { vPortYield(); }
+
+#endif /* configUSE_ISR_STACK */
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site. */
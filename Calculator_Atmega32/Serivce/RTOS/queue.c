@@ -122,6 +122,28 @@ zero. */
 	#define queueYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
 #endif
 
+#if ( configUSE_QUEUE_COPY_ROUTINES == 1 )
+
+	/* Items up to this size that have no copy routine of their own are copied
+	by prvCopyItemSmall(), larger ones by memcpy(). */
+	#define queueSMALL_ITEM_MAX_SIZE		( ( UBaseType_t ) 16U )
+
+	/* Copies one item in or out of a queue.  The routine is picked for the
+	item size when the queue is created, see prvSelectCopyFunction(), so the
+	common small items avoid the call into the library memcpy() and its byte
+	loop, at the cost of a pointer in each queue and an indirect call.  The gain
+	is only measured on the host so far, Tools/QueueBench has an ATmega32 build
+	for the target figures. */
+	typedef void ( *QueueCopyFunction_t )( void *pvDest, const void *pvSource, UBaseType_t uxItemSize );
+
+	#define queueCOPY_ITEM( pxQueue, pvDest, pvSource )	( pxQueue )->pxCopyItem( ( pvDest ), ( pvSource ), ( pxQueue )->uxItemSize )
+
+#else
+
+	#define queueCOPY_ITEM( pxQueue, pvDest, pvSource )	( void ) memcpy( ( pvDest ), ( pvSource ), ( size_t ) ( pxQueue )->uxItemSize )
+
+#endif /* configUSE_QUEUE_COPY_ROUTINES */
+
 /*
  * Definition of the queue used by the scheduler.
  * Items are queued by copy, not reference.  See the following link for the
@@ -132,6 +154,9 @@ typedef struct QueueDefinition
 	int8_t *pcHead;					/*< Points to the beginning of the queue storage area. */
 	int8_t *pcTail;					/*< Points to the byte at the end of the queue storage area.  Once more byte is allocated than necessary to store the queue items, this is used as a marker. */
 	int8_t *pcWriteTo;				/*< Points to the free next place in the storage area. */
+	#if ( configUSE_QUEUE_COPY_ROUTINES == 1 )
+		QueueCopyFunction_t pxCopyItem;	/*< Copies an item of uxItemSize bytes in or out of the storage area. */
+	#endif
 
 	union							/* Use of a union is an exception to the coding standard to ensure two mutually exclusive structure members don't appear simultaneously (wasting RAM). */
 	{
@@ -232,6 +257,21 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copy uxCount items into, or out of, a queue known to have the space or the
+ * items.  The items are contiguous in the storage area up to pcTail, so a
+ * batch is at most two memcpy() calls.
+ */
+static void prvCopyBatchToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+static void prvCopyBatchFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes up to uxMaxTasks tasks from pxEventList.
+ *
+ * @return pdTRUE if any of them has a priority above the calling task.
+ */
+static BaseType_t prvUnblockTasks( List_t * const pxEventList, UBaseType_t uxMaxTasks ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -246,6 +286,23 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
  */
 static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, const uint8_t ucQueueType, Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_QUEUE_COPY_ROUTINES == 1 )
+	/*
+	 * Returns the routine that copies items of uxItemSize bytes.  Items of 1,
+	 * 2, 3, 4 and 8 bytes are copied by straight line code, other items up to
+	 * queueSMALL_ITEM_MAX_SIZE bytes by an unrolled loop and the rest by
+	 * memcpy().
+	 */
+	static QueueCopyFunction_t prvSelectCopyFunction( const UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+	static void prvCopyItem1( void *pvDest, const void *pvSource, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+	static void prvCopyItem2( void *pvDest, const void *pvSource, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+	static void prvCopyItem3( void *pvDest, const void *pvSource, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+	static void prvCopyItem4( void *pvDest, const void *pvSource, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+	static void prvCopyItem8( void *pvDest, const void *pvSource, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+	static void prvCopyItemSmall( void *pvDest, const void *pvSource, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+	static void prvCopyItemGeneric( void *pvDest, const void *pvSource, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Mutexes are a special type of queue.  When a mutex is created, first the
  * queue is created, then prvInitialiseMutex() is called to configure the queue
@@ -453,6 +510,11 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	defined. */
 	pxNewQueue->uxLength = uxQueueLength;
 	pxNewQueue->uxItemSize = uxItemSize;
+	#if ( configUSE_QUEUE_COPY_ROUTINES == 1 )
+	{
+		pxNewQueue->pxCopyItem = prvSelectCopyFunction( uxItemSize );
+	}
+	#endif /* configUSE_QUEUE_COPY_ROUTINES */
 	( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
 	#if ( configUSE_TRACE_FACILITY == 1 )
@@ -749,6 +811,8 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			queue is full. */
 			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
 			{
+			const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
+
 				traceQUEUE_SEND( pxQueue );
 				xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
@@ -756,7 +820,14 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						if( ( xCopyPosition == queueOVERWRITE ) && ( uxPreviousMessagesWaiting != ( UBaseType_t ) 0 ) )
+						{
+							/* Do not notify the queue set as an existing item
+							was overwritten in the queue so the number of items
+							in the queue has not changed. */
+							mtCOVERAGE_TEST_MARKER();
+						}
+						else if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
 						{
 							/* The queue is a member of a queue set, and posting
 							to the queue set caused a higher priority task to
@@ -954,6 +1025,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
 		{
 			const int8_t cTxLock = pxQueue->cTxLock;
+			const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
 
 			traceQUEUE_SEND_FROM_ISR( pxQueue );
 
@@ -972,7 +1044,14 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						if( ( xCopyPosition == queueOVERWRITE ) && ( uxPreviousMessagesWaiting != ( UBaseType_t ) 0 ) )
+						{
+							/* Do not notify the queue set as an existing item
+							was overwritten in the queue so the number of items
+							in the queue has not changed. */
+							mtCOVERAGE_TEST_MARKER();
+						}
+						else if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
 						{
 							/* The queue is a member of a queue set, and posting
 							to the queue set caused a higher priority task to
@@ -1576,6 +1655,184 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 }
 /*-----------------------------------------------------------*/
 
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, TickType_t xTicksToWait )
+{
+UBaseType_t uxSent, uxSpaces;
+BaseType_t xYieldRequired = pdFALSE;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvItems );
+	/* Semaphores and mutexes have no items to batch. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	taskENTER_CRITICAL();
+	{
+		uxSpaces = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+		uxSent = ( uxCount < uxSpaces ) ? uxCount : uxSpaces;
+
+		if( uxSent > ( UBaseType_t ) 0 )
+		{
+			traceQUEUE_SEND( pxQueue );
+			prvCopyBatchToQueue( pxQueue, ( const int8_t * ) pvItems, uxSent );
+
+			#if ( configUSE_QUEUE_SETS == 1 )
+			{
+				if( pxQueue->pxQueueSetContainer != NULL )
+				{
+				UBaseType_t uxItem;
+
+					/* The set holds one handle per item, as the reader
+					selects from the set once for each item it receives. */
+					for( uxItem = 0; uxItem < uxSent; uxItem++ )
+					{
+						if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+						{
+							xYieldRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				else
+				{
+					xYieldRequired = prvUnblockTasks( &( pxQueue->xTasksWaitingToReceive ), uxSent );
+				}
+			}
+			#else /* configUSE_QUEUE_SETS */
+			{
+				xYieldRequired = prvUnblockTasks( &( pxQueue->xTasksWaitingToReceive ), uxSent );
+			}
+			#endif /* configUSE_QUEUE_SETS */
+
+			/* One context switch for the whole batch, however many tasks
+			it unblocked. */
+			if( xYieldRequired != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( ( uxSent == ( UBaseType_t ) 0 ) && ( uxCount != ( UBaseType_t ) 0 ) )
+	{
+		if( xTicksToWait != ( TickType_t ) 0 )
+		{
+			/* The queue is full.  Block for the first item as a single send
+			would, then send whatever else fits without blocking again. */
+			if( xQueueGenericSend( xQueue, pvItems, xTicksToWait, queueSEND_TO_BACK ) != pdFALSE )
+			{
+				uxSent = ( UBaseType_t ) 1 + xQueueSendMultiple( xQueue, ( const int8_t * ) pvItems + pxQueue->uxItemSize, uxCount - ( UBaseType_t ) 1, 0 ); /*lint !e961 Pointer arithmetic on the caller's item array. */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			traceQUEUE_SEND_FAILED( pxQueue );
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxSent;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxCount, TickType_t xTicksToWait )
+{
+UBaseType_t uxReceived;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
+	/* Semaphores and mutexes have no items to batch. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	taskENTER_CRITICAL();
+	{
+		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+		uxReceived = ( uxMaxCount < uxMessagesWaiting ) ? uxMaxCount : uxMessagesWaiting;
+
+		if( uxReceived > ( UBaseType_t ) 0 )
+		{
+			traceQUEUE_RECEIVE( pxQueue );
+			prvCopyBatchFromQueue( pxQueue, ( int8_t * ) pvBuffer, uxReceived );
+			pxQueue->uxMessagesWaiting = uxMessagesWaiting - uxReceived;
+
+			/* Every freed space can take a waiting sender, but there is only
+			one context switch for the batch. */
+			if( prvUnblockTasks( &( pxQueue->xTasksWaitingToSend ), uxReceived ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( ( uxReceived == ( UBaseType_t ) 0 ) && ( uxMaxCount != ( UBaseType_t ) 0 ) )
+	{
+		if( xTicksToWait != ( TickType_t ) 0 )
+		{
+			/* The queue is empty.  Block for the first item as a single
+			receive would, then take whatever else has arrived. */
+			if( xQueueGenericReceive( xQueue, pvBuffer, xTicksToWait, pdFALSE ) != pdFALSE )
+			{
+				uxReceived = ( UBaseType_t ) 1 + xQueueReceiveMultiple( xQueue, ( int8_t * ) pvBuffer + pxQueue->uxItemSize, uxMaxCount - ( UBaseType_t ) 1, 0 ); /*lint !e961 Pointer arithmetic on the caller's buffer. */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FAILED( pxQueue );
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxReceived;
+}
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
 {
 UBaseType_t uxReturn;
@@ -1722,7 +1979,7 @@ UBaseType_t uxMessagesWaiting;
 	}
 	else if( xPosition == queueSEND_TO_BACK )
 	{
-		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0. */
+		queueCOPY_ITEM( pxQueue, ( void * ) pxQueue->pcWriteTo, pvItemToQueue ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
 		pxQueue->pcWriteTo += pxQueue->uxItemSize;
 		if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
 		{
@@ -1735,7 +1992,7 @@ UBaseType_t uxMessagesWaiting;
 	}
 	else
 	{
-		( void ) memcpy( ( void * ) pxQueue->u.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		queueCOPY_ITEM( pxQueue, ( void * ) pxQueue->u.pcReadFrom, pvItemToQueue ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 		pxQueue->u.pcReadFrom -= pxQueue->uxItemSize;
 		if( pxQueue->u.pcReadFrom < pxQueue->pcHead ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
 		{
@@ -1786,11 +2043,217 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
-		( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0. */
+		queueCOPY_ITEM( pxQueue, ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyBatchToQueue( Queue_t * const pxQueue, const int8_t *pcItems, const UBaseType_t uxCount )
+{
+const size_t xBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+const size_t xBytesToTail = ( size_t ) ( pxQueue->pcTail - pxQueue->pcWriteTo ); /*lint !e946 !e947 The write position is always inside the storage area. */
+
+	if( xBytes < xBytesToTail )
+	{
+		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcItems, xBytes );
+		pxQueue->pcWriteTo += xBytes;
+	}
+	else
+	{
+		/* The batch wraps, or ends exactly, at pcTail.  The storage area is
+		a whole number of items so the split never falls inside one. */
+		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcItems, xBytesToTail );
+		( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) ( pcItems + xBytesToTail ), xBytes - xBytesToTail );
+		pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytes - xBytesToTail );
+	}
+
+	pxQueue->uxMessagesWaiting += uxCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyBatchFromQueue( Queue_t * const pxQueue, int8_t *pcBuffer, const UBaseType_t uxCount )
+{
+const size_t xBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+size_t xBytesToTail;
+int8_t *pcFirst;
+
+	/* pcReadFrom points at the last item read, the batch starts after it. */
+	pcFirst = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+	if( pcFirst >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+	{
+		pcFirst = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	xBytesToTail = ( size_t ) ( pxQueue->pcTail - pcFirst ); /*lint !e946 !e947 The read position is always inside the storage area. */
+
+	if( xBytes <= xBytesToTail )
+	{
+		( void ) memcpy( ( void * ) pcBuffer, ( const void * ) pcFirst, xBytes );
+		pxQueue->u.pcReadFrom = pcFirst + ( xBytes - pxQueue->uxItemSize );
+	}
+	else
+	{
+		( void ) memcpy( ( void * ) pcBuffer, ( const void * ) pcFirst, xBytesToTail );
+		( void ) memcpy( ( void * ) ( pcBuffer + xBytesToTail ), ( const void * ) pxQueue->pcHead, xBytes - xBytesToTail );
+		pxQueue->u.pcReadFrom = pxQueue->pcHead + ( ( xBytes - xBytesToTail ) - pxQueue->uxItemSize );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockTasks( List_t * const pxEventList, UBaseType_t uxMaxTasks )
+{
+BaseType_t xYieldRequired = pdFALSE;
+
+	while( ( uxMaxTasks > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+	{
+		if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+		{
+			xYieldRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+		uxMaxTasks--;
 	}
+
+	return xYieldRequired;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_COPY_ROUTINES == 1 )
+
+	static QueueCopyFunction_t prvSelectCopyFunction( const UBaseType_t uxItemSize )
+	{
+	QueueCopyFunction_t pxCopyItem;
+
+		switch( uxItemSize )
+		{
+			case 1:		pxCopyItem = prvCopyItem1;
+						break;
+			case 2:		pxCopyItem = prvCopyItem2;
+						break;
+			case 3:		pxCopyItem = prvCopyItem3;
+						break;
+			case 4:		pxCopyItem = prvCopyItem4;
+						break;
+			case 8:		pxCopyItem = prvCopyItem8;
+						break;
+			default:	/* Semaphores have no items, the generic copy is never
+						called for them. */
+						if( ( uxItemSize != ( UBaseType_t ) 0 ) && ( uxItemSize <= queueSMALL_ITEM_MAX_SIZE ) )
+						{
+							pxCopyItem = prvCopyItemSmall;
+						}
+						else
+						{
+							pxCopyItem = prvCopyItemGeneric;
+						}
+						break;
+		}
+
+		return pxCopyItem;
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvCopyItem1( void *pvDest, const void *pvSource, UBaseType_t uxItemSize )
+	{
+		( void ) uxItemSize;
+		*( ( uint8_t * ) pvDest ) = *( ( const uint8_t * ) pvSource );
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvCopyItem2( void *pvDest, const void *pvSource, UBaseType_t uxItemSize )
+	{
+	uint8_t * const pucDest = ( uint8_t * ) pvDest;
+	const uint8_t * const pucSource = ( const uint8_t * ) pvSource;
+
+		/* Byte accesses, items have no alignment in the storage area. */
+		( void ) uxItemSize;
+		pucDest[ 0 ] = pucSource[ 0 ];
+		pucDest[ 1 ] = pucSource[ 1 ];
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvCopyItem3( void *pvDest, const void *pvSource, UBaseType_t uxItemSize )
+	{
+	uint8_t * const pucDest = ( uint8_t * ) pvDest;
+	const uint8_t * const pucSource = ( const uint8_t * ) pvSource;
+
+		( void ) uxItemSize;
+		pucDest[ 0 ] = pucSource[ 0 ];
+		pucDest[ 1 ] = pucSource[ 1 ];
+		pucDest[ 2 ] = pucSource[ 2 ];
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvCopyItem4( void *pvDest, const void *pvSource, UBaseType_t uxItemSize )
+	{
+	uint8_t * const pucDest = ( uint8_t * ) pvDest;
+	const uint8_t * const pucSource = ( const uint8_t * ) pvSource;
+
+		( void ) uxItemSize;
+		pucDest[ 0 ] = pucSource[ 0 ];
+		pucDest[ 1 ] = pucSource[ 1 ];
+		pucDest[ 2 ] = pucSource[ 2 ];
+		pucDest[ 3 ] = pucSource[ 3 ];
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvCopyItem8( void *pvDest, const void *pvSource, UBaseType_t uxItemSize )
+	{
+	uint8_t * const pucDest = ( uint8_t * ) pvDest;
+	const uint8_t * const pucSource = ( const uint8_t * ) pvSource;
+
+		( void ) uxItemSize;
+		pucDest[ 0 ] = pucSource[ 0 ];
+		pucDest[ 1 ] = pucSource[ 1 ];
+		pucDest[ 2 ] = pucSource[ 2 ];
+		pucDest[ 3 ] = pucSource[ 3 ];
+		pucDest[ 4 ] = pucSource[ 4 ];
+		pucDest[ 5 ] = pucSource[ 5 ];
+		pucDest[ 6 ] = pucSource[ 6 ];
+		pucDest[ 7 ] = pucSource[ 7 ];
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvCopyItemSmall( void *pvDest, const void *pvSource, UBaseType_t uxItemSize )
+	{
+	uint8_t *pucDest = ( uint8_t * ) pvDest;
+	const uint8_t *pucSource = ( const uint8_t * ) pvSource;
+
+		/* Four bytes per pass, so the loop overhead is paid once per four
+		bytes, then the up to three bytes left. */
+		while( uxItemSize >= ( UBaseType_t ) 4U )
+		{
+			pucDest[ 0 ] = pucSource[ 0 ];
+			pucDest[ 1 ] = pucSource[ 1 ];
+			pucDest[ 2 ] = pucSource[ 2 ];
+			pucDest[ 3 ] = pucSource[ 3 ];
+			pucDest += 4;
+			pucSource += 4;
+			uxItemSize -= ( UBaseType_t ) 4U;
+		}
+
+		while( uxItemSize > ( UBaseType_t ) 0U )
+		{
+			*pucDest++ = *pucSource++;
+			uxItemSize--;
+		}
+	}
+/*-----------------------------------------------------------*/
+
+	static void prvCopyItemGeneric( void *pvDest, const void *pvSource, UBaseType_t uxItemSize )
+	{
+		( void ) memcpy( pvDest, pvSource, ( size_t ) uxItemSize );
+	}
+
+#endif /* configUSE_QUEUE_COPY_ROUTINES */
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -1995,6 +2458,9 @@ BaseType_t xReturn;
 	{
 	BaseType_t xReturn;
 	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+	#if ( configUSE_QUEUE_SETS == 1 )
+		BaseType_t xSetTaskWoken = pdFALSE;
+	#endif
 
 		/* If the queue is already full we may have to block.  A critical section
 		is required to prevent an interrupt removing something from the queue
@@ -2030,6 +2496,23 @@ BaseType_t xReturn;
 				prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
 				xReturn = pdPASS;
 
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+					/* A co-routine can post to a queue that is in a set a
+					task blocks on.  Only tasks block on sets, so the set is
+					posted to as xQueueGenericSend() would, and no co-routine
+					can be waiting on the queue itself. */
+					if( pxQueue->pxQueueSetContainer != NULL )
+					{
+						xSetTaskWoken = prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_QUEUE_SETS */
+
 				/* Were any co-routines waiting for data to become available? */
 				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
@@ -2060,6 +2543,21 @@ BaseType_t xReturn;
 		}
 		portENABLE_INTERRUPTS();
 
+		#if ( configUSE_QUEUE_SETS == 1 )
+		{
+			/* Co-routines run in the idle task, so a task woken through the
+			set always has a higher priority than the caller. */
+			if( xSetTaskWoken != pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_QUEUE_SETS */
+
 		return xReturn;
 	}
 
@@ -2118,7 +2616,7 @@ BaseType_t xReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 				--( pxQueue->uxMessagesWaiting );
-				( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+				queueCOPY_ITEM( pxQueue, ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom );
 
 				xReturn = pdPASS;
 
@@ -2226,7 +2724,7 @@ BaseType_t xReturn;
 				mtCOVERAGE_TEST_MARKER();
 			}
 			--( pxQueue->uxMessagesWaiting );
-			( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+			queueCOPY_ITEM( pxQueue, ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom );
 
 			if( ( *pxCoRoutineWoken ) == pdFALSE )
 			{
@@ -2403,6 +2901,22 @@ BaseType_t xReturn;
 #endif /* configUSE_QUEUE_SETS */
 /*-----------------------------------------------------------*/
 
+#if( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueSetHandle_t xQueueCreateSetStatic( const UBaseType_t uxEventQueueLength, uint8_t *pucQueueStorage, StaticQueue_t *pxStaticQueue )
+	{
+	QueueSetHandle_t pxQueue;
+
+		/* The set holds one handle per event, so pucQueueStorage must be at
+		least uxEventQueueLength * sizeof( QueueSetMemberHandle_t ) bytes. */
+		pxQueue = xQueueGenericCreateStatic( uxEventQueueLength, sizeof( Queue_t * ), pucQueueStorage, pxStaticQueue, queueQUEUE_TYPE_SET );
+
+		return pxQueue;
+	}
+
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 	BaseType_t xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet )
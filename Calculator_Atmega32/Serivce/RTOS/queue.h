@@ -1012,6 +1012,89 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue, void * const pvBuffer ) PRIV
  */
 BaseType_t xQueueGenericReceive( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait, const BaseType_t xJustPeek ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueSendMultiple(
+								QueueHandle_t xQueue,
+								const void *pvItems,
+								UBaseType_t uxCount,
+								TickType_t xTicksToWait
+							);
+ * </pre>
+ *
+ * Post up to uxCount items to the back of a queue in one critical section.
+ * The items are copied as one block, split in two where the queue storage
+ * wraps, and the tasks waiting to receive are unblocked together with at most
+ * one context switch for the batch.  Use it where items arrive in bursts and
+ * the per item cost of xQueueSend() dominates.
+ *
+ * Items are sent in order until the queue is full, the call does not wait
+ * for room for the whole batch.  If no item fits the calling task blocks, for
+ * at most xTicksToWait, until the first one does as xQueueSend() would.
+ *
+ * This function must not be used on a semaphore or a mutex, or from an
+ * interrupt service routine.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems Pointer to an array of uxCount items, each the item size
+ * defined when the queue was created.
+ *
+ * @param uxCount The number of items in pvItems.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.
+ *
+ * @return The number of items posted, from the start of pvItems.
+ *
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItems, const UBaseType_t uxCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueReceiveMultiple(
+									QueueHandle_t xQueue,
+									void *pvBuffer,
+									UBaseType_t uxMaxCount,
+									TickType_t xTicksToWait
+								);
+ * </pre>
+ *
+ * Receive up to uxMaxCount items from a queue in one critical section, the
+ * batch counterpart of xQueueReceive().  The tasks waiting for space are
+ * unblocked together with at most one context switch for the batch.
+ *
+ * The items already in the queue are returned without waiting for more.  If
+ * the queue is empty the calling task blocks, for at most xTicksToWait, until
+ * the first item arrives as xQueueReceive() would, then takes that item and
+ * any that came with it.
+ *
+ * This function must not be used on a semaphore or a mutex, or from an
+ * interrupt service routine.  A queue in a queue set must be read one item
+ * for each time it is selected from the set, so must not be read with this
+ * function.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer with room for uxMaxCount items.
+ *
+ * @param uxMaxCount The most items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty.
+ *
+ * @return The number of items copied to pvBuffer, oldest first.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * <pre>UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue );</pre>
@@ -1698,6 +1781,26 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t pxMutex ) PRIVILEGED_FUNCTION
  */
 QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength ) PRIVILEGED_FUNCTION;
 
+/*
+ * Creates a queue set as xQueueCreateSet() does, but the RAM used by the set
+ * is provided by the caller instead of being allocated from the heap.
+ *
+ * @param uxEventQueueLength As for xQueueCreateSet().
+ *
+ * @param pucQueueStorage Must point to an array of at least
+ * uxEventQueueLength * sizeof( QueueSetMemberHandle_t ) bytes, which will hold
+ * the handles of the members that contain data.
+ *
+ * @param pxStaticQueue Must point to a variable of type StaticQueue_t, which
+ * will be used to hold the queue set's data structure.
+ *
+ * @return If neither pucQueueStorage nor pxStaticQueue are NULL then a handle
+ * to the created queue set is returned.
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	QueueSetHandle_t xQueueCreateSetStatic( const UBaseType_t uxEventQueueLength, uint8_t *pucQueueStorage, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Adds a queue or semaphore to a queue set that was previously created by a
  * call to xQueueCreateSet().
@@ -0,0 +1,991 @@
+/*
+    FreeRTOS V9.0.0 - Copyright (C) 2016 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to build stream_buffer.c
+#endif
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include stream buffer functionality.  This #if is closed at the very bottom
+of this file.  If you want to include stream and message buffers then ensure
+configUSE_STREAM_BUFFERS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_STREAM_BUFFERS == 1 )
+
+/* The number of bytes used to hold the length of a message in the buffer. */
+#define sbBYTES_TO_STORE_MESSAGE_LENGTH ( sizeof( UBaseType_t ) )
+
+/* Bits stored in the ucFlags field of the stream buffer. */
+#define sbFLAGS_IS_MESSAGE_BUFFER			( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
+#define sbFLAGS_IS_STATICALLY_ALLOCATED		( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
+
+/* The largest number of bytes a stream buffer can hold.  One byte of the
+storage area is never used, so the length of the storage area still fits the
+UBaseType_t indexes. */
+#define sbMAX_BUFFER_SIZE					( ( size_t ) ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) ) - ( size_t ) 1 )
+
+/*-----------------------------------------------------------*/
+
+/* Structure that hold state information on the buffer.  The writer only ever
+writes uxHead and the reader only ever writes uxTail, each reads the other's
+index once per call.  As both are a UBaseType_t those accesses are atomic and
+no critical section is needed to move data.  The uxReceiverWaiting and
+uxSenderWaiting flags are what the other side checks to know whether it has a
+task to notify, the task handles are only read once the flag is seen set. */
+typedef struct xSTREAM_BUFFER /*lint !e9058 Style convention uses tag. */
+{
+	volatile UBaseType_t uxTail;				/* Index to the next item to read within the buffer. */
+	volatile UBaseType_t uxHead;				/* Index to the next item to write within the buffer. */
+	UBaseType_t uxLength;						/* The length of the buffer pointed to by pucBuffer, one more than the bytes it can hold. */
+	volatile UBaseType_t uxTriggerLevelBytes;	/* The number of bytes that must be in the stream buffer before a task that is waiting for data is unblocked. */
+	volatile UBaseType_t uxReceiverWaiting;		/* pdTRUE while xTaskWaitingToReceive is blocked on the buffer. */
+	volatile UBaseType_t uxSenderWaiting;		/* pdTRUE while xTaskWaitingToSend is blocked on the buffer. */
+	TaskHandle_t xTaskWaitingToReceive;			/* Holds the handle of a task waiting for data. */
+	TaskHandle_t xTaskWaitingToSend;			/* Holds the handle of a task waiting to send data to a message buffer that is full. */
+	uint8_t *pucBuffer;							/* Points to the buffer itself - that is - the RAM that stores the data passed through the buffer. */
+	uint8_t ucFlags;
+} StreamBuffer_t;
+
+/*
+ * The number of bytes available to be read from, or written to, the buffer
+ * given the two indexes.
+ */
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer, UBaseType_t uxHead, UBaseType_t uxTail ) PRIVILEGED_FUNCTION;
+static size_t prvSpacesInBuffer( const StreamBuffer_t * const pxStreamBuffer, UBaseType_t uxHead, UBaseType_t uxTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy xCount bytes into the buffer starting at uxHead, or out of it starting
+ * at uxTail, wrapping around the end of the storage area.  Neither moves the
+ * index held in the stream buffer, the new index is returned instead so the
+ * caller can publish it once the data is in place.
+ */
+static UBaseType_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, UBaseType_t uxHead ) PRIVILEGED_FUNCTION;
+static UBaseType_t prvReadBytesFromBuffer( const StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount, UBaseType_t uxTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * The common part of the send and receive functions.  Writes as much of the
+ * stream (or the whole message) as there is space for, or reads as much of the
+ * stream (or the next message) as there is, and returns the number of bytes
+ * of data moved.
+ */
+static size_t prvWriteToBuffer( StreamBuffer_t * const pxStreamBuffer, const void *pvTxData, size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+static size_t prvReadFromBuffer( StreamBuffer_t * const pxStreamBuffer, void *pvRxData, size_t xBufferLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * If the flag pointed to by puxWaiting is set, clear it and notify the task
+ * pxTask points to.  The flag is checked without a critical section first so
+ * nothing is masked when no task waits.
+ */
+static void prvNotifyWaitingTask( volatile UBaseType_t * const puxWaiting, TaskHandle_t * const pxTask ) PRIVILEGED_FUNCTION;
+static void prvNotifyWaitingTaskFromISR( volatile UBaseType_t * const puxWaiting, TaskHandle_t * const pxTask, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by both the create functions to set up the stream buffer structure.
+ */
+static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer, uint8_t * const pucBuffer, size_t xBufferSizeBytes, size_t xTriggerLevelBytes, uint8_t ucFlags ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer )
+	{
+	uint8_t *pucAllocatedMemory;
+
+		/* A message buffer must at least hold the length of one message, and
+		the length of the storage area must fit the indexes. */
+		configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+		configASSERT( xBufferSizeBytes <= sbMAX_BUFFER_SIZE );
+		configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
+
+		/* The structure and the storage area are allocated in one go, the
+		storage area being one byte longer than the buffer size. */
+		pucAllocatedMemory = ( uint8_t * ) pvPortMalloc( sizeof( StreamBuffer_t ) + xBufferSizeBytes + ( size_t ) 1 ); /*lint !e9079 malloc() only returns void*. */
+
+		if( pucAllocatedMemory != NULL )
+		{
+			prvInitialiseNewStreamBuffer( ( StreamBuffer_t * ) pucAllocatedMemory, /* Structure at the start of the allocated memory. */ /*lint !e9087 Safe cast as allocated memory is aligned. */ /*lint !e826 Area is not too small and alignment is guaranteed provided malloc() behaves as expected and returns aligned buffer. */
+										  pucAllocatedMemory + sizeof( StreamBuffer_t ),  /* Storage area follows. */ /*lint !e9016 Indexing past structure valid for uint8_t pointer, also storage area has no alignment requirement. */
+										  xBufferSizeBytes,
+										  xTriggerLevelBytes,
+										  ( xIsMessageBuffer != pdFALSE ) ? sbFLAGS_IS_MESSAGE_BUFFER : ( uint8_t ) 0 );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( StreamBufferHandle_t ) pucAllocatedMemory; /*lint !e9087 !e826 Safe cast as allocated memory is aligned. */
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	StreamBufferHandle_t xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer, uint8_t * const pucStreamBufferStorageArea, StaticStreamBuffer_t * const pxStaticStreamBuffer )
+	{
+	StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) pxStaticStreamBuffer; /*lint !e740 !e9087 Safe cast as StaticStreamBuffer_t is opaque Streambuffer_t. */
+	StreamBufferHandle_t xReturn;
+
+		configASSERT( pucStreamBufferStorageArea );
+		configASSERT( pxStaticStreamBuffer );
+		configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+		configASSERT( xBufferSizeBytes <= sbMAX_BUFFER_SIZE );
+		configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticStreamBuffer_t equals the size of the real
+			stream buffer structure. */
+			volatile size_t xSize = sizeof( StaticStreamBuffer_t );
+			configASSERT( xSize == sizeof( StreamBuffer_t ) );
+		}
+		#endif /* configASSERT_DEFINED */
+
+		if( ( pucStreamBufferStorageArea != NULL ) && ( pxStaticStreamBuffer != NULL ) )
+		{
+			prvInitialiseNewStreamBuffer( pxStreamBuffer,
+										  pucStreamBufferStorageArea,
+										  xBufferSizeBytes,
+										  xTriggerLevelBytes,
+										  ( uint8_t ) ( ( ( xIsMessageBuffer != pdFALSE ) ? sbFLAGS_IS_MESSAGE_BUFFER : 0U ) | sbFLAGS_IS_STATICALLY_ALLOCATED ) );
+
+			xReturn = ( StreamBufferHandle_t ) pxStaticStreamBuffer; /*lint !e9087 Data hiding requires cast to opaque type. */
+		}
+		else
+		{
+			xReturn = NULL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+	{
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			/* Both the structure and the buffer were allocated using a single call
+			to pvPortMalloc(), hence only one call to vPortFree() is required. */
+			vPortFree( ( void * ) pxStreamBuffer ); /*lint !e9087 Standard free() semantics require void *, plus pxStreamBuffer was allocated by pvPortMalloc(). */
+		}
+		#else
+		{
+			/* Should not be possible to get here, ucFlags must be corrupt.
+			Force an assert. */
+			configASSERT( xStreamBuffer == ( StreamBufferHandle_t ) ~0 );
+		}
+		#endif
+	}
+	else
+	{
+		/* The structure and buffer were not allocated dynamically and cannot be
+		freed - just scrub the structure so future use will assert. */
+		memset( pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxStreamBuffer );
+
+	/* Can only reset a buffer if there are no tasks blocked on it. */
+	taskENTER_CRITICAL();
+	{
+		if( ( pxStreamBuffer->uxReceiverWaiting == ( UBaseType_t ) pdFALSE ) && ( pxStreamBuffer->uxSenderWaiting == ( UBaseType_t ) pdFALSE ) )
+		{
+			pxStreamBuffer->uxHead = ( UBaseType_t ) 0;
+			pxStreamBuffer->uxTail = ( UBaseType_t ) 0;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	/* It is not valid for the trigger level to be 0. */
+	if( xTriggerLevel == ( size_t ) 0 )
+	{
+		xTriggerLevel = ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The trigger level is the number of bytes that must be in the stream
+	buffer before a task that is waiting for data is unblocked. */
+	if( xTriggerLevel < ( size_t ) pxStreamBuffer->uxLength )
+	{
+		pxStreamBuffer->uxTriggerLevelBytes = ( UBaseType_t ) xTriggerLevel;
+		xReturn = pdPASS;
+	}
+	else
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	return prvSpacesInBuffer( pxStreamBuffer, pxStreamBuffer->uxHead, pxStreamBuffer->uxTail );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	return prvBytesInBuffer( pxStreamBuffer, pxStreamBuffer->uxHead, pxStreamBuffer->uxTail );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+{
+const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	/* True if no bytes are available. */
+	if( pxStreamBuffer->uxHead == pxStreamBuffer->uxTail )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+{
+BaseType_t xReturn;
+size_t xBytesToStoreMessageLength;
+const StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	/* A message buffer is full once it cannot hold the length of another
+	message. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = 0;
+	}
+
+	/* True if there is no space left for data. */
+	if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn, xSpace = 0;
+size_t xRequiredSpace = xDataLengthBytes;
+TimeOut_t xTimeOut;
+
+	configASSERT( pvTxData );
+	configASSERT( pxStreamBuffer );
+
+	/* This send function is used to write to both message buffers and stream
+	buffers.  If this is a message buffer then the space needed must be
+	increased by the amount of bytes needed to store the length of the
+	message. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+		/* A message that can never fit would block forever. */
+		configASSERT( xRequiredSpace < ( size_t ) pxStreamBuffer->uxLength );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		do
+		{
+			/* Wait until the required number of bytes are free in the
+			buffer.  The check and the registration as a waiting task are
+			done together so a reader that frees space in between always
+			sees the flag, and its notification is not lost. */
+			taskENTER_CRITICAL();
+			{
+				xSpace = prvSpacesInBuffer( pxStreamBuffer, pxStreamBuffer->uxHead, pxStreamBuffer->uxTail );
+
+				if( xSpace < xRequiredSpace )
+				{
+					/* Clear notification state as going to wait for space. */
+					( void ) xTaskNotifyStateClear( NULL );
+
+					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+					pxStreamBuffer->uxSenderWaiting = ( UBaseType_t ) pdTRUE;
+				}
+				else
+				{
+					taskEXIT_CRITICAL();
+					break;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+
+			/* A single byte write, the reader can not see half of it. */
+			pxStreamBuffer->uxSenderWaiting = ( UBaseType_t ) pdFALSE;
+
+		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xReturn = prvWriteToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes );
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		/* Was a task waiting for the data? */
+		if( xStreamBufferBytesAvailable( xStreamBuffer ) >= ( size_t ) pxStreamBuffer->uxTriggerLevelBytes )
+		{
+			prvNotifyWaitingTask( &( pxStreamBuffer->uxReceiverWaiting ), &( pxStreamBuffer->xTaskWaitingToReceive ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pvTxData );
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvWriteToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes );
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		/* Was a task waiting for the data? */
+		if( xStreamBufferBytesAvailable( xStreamBuffer ) >= ( size_t ) pxStreamBuffer->uxTriggerLevelBytes )
+		{
+			prvNotifyWaitingTaskFromISR( &( pxStreamBuffer->uxReceiverWaiting ), &( pxStreamBuffer->xTaskWaitingToReceive ), pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReceivedLength = 0, xBytesAvailable;
+UBaseType_t uxTail;
+
+	configASSERT( pvRxData );
+	configASSERT( pxStreamBuffer );
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		/* Checking if there is data and registering as the waiting task is
+		done together so a writer that adds data in between always sees the
+		flag, and its notification is not lost. */
+		taskENTER_CRITICAL();
+		{
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer, pxStreamBuffer->uxHead, pxStreamBuffer->uxTail );
+
+			/* A message is published together with its length, so for both
+			stream and message buffers any data at all is something to
+			read. */
+			if( xBytesAvailable == ( size_t ) 0 )
+			{
+				/* Clear notification state as going to wait for data. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+				pxStreamBuffer->uxReceiverWaiting = ( UBaseType_t ) pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBytesAvailable == ( size_t ) 0 )
+		{
+			/* Wait for data to be available, the writer only notifies once
+			the trigger level is reached. */
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->uxReceiverWaiting = ( UBaseType_t ) pdFALSE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	uxTail = pxStreamBuffer->uxTail;
+	xReceivedLength = prvReadFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes );
+
+	/* Was a task waiting for space in the buffer?  A zero length message
+	frees space too, so the index is checked rather than the length. */
+	if( uxTail != pxStreamBuffer->uxTail )
+	{
+		prvNotifyWaitingTask( &( pxStreamBuffer->uxSenderWaiting ), &( pxStreamBuffer->xTaskWaitingToSend ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReceivedLength;
+UBaseType_t uxTail;
+
+	configASSERT( pvRxData );
+	configASSERT( pxStreamBuffer );
+
+	uxTail = pxStreamBuffer->uxTail;
+	xReceivedLength = prvReadFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes );
+
+	/* Was a task waiting for space in the buffer? */
+	if( uxTail != pxStreamBuffer->uxTail )
+	{
+		prvNotifyWaitingTaskFromISR( &( pxStreamBuffer->uxSenderWaiting ), &( pxStreamBuffer->xTaskWaitingToSend ), pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteToBuffer( StreamBuffer_t * const pxStreamBuffer, const void *pvTxData, size_t xDataLengthBytes )
+{
+UBaseType_t uxHead, uxMessageLength;
+size_t xSpace;
+BaseType_t xPublish = pdFALSE;
+
+	/* Only the writer moves uxHead, so it can be used as it is.  uxTail is
+	read once, the reader can only make more space after that. */
+	uxHead = pxStreamBuffer->uxHead;
+	xSpace = prvSpacesInBuffer( pxStreamBuffer, uxHead, pxStreamBuffer->uxTail );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* A message is written whole, behind its length, or not at all. */
+		if( xSpace >= ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+		{
+			uxMessageLength = ( UBaseType_t ) xDataLengthBytes;
+			uxHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &uxMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, uxHead );
+			xPublish = pdTRUE;
+		}
+		else
+		{
+			xDataLengthBytes = 0;
+		}
+	}
+	else
+	{
+		/* A stream is written as far as it fits. */
+		if( xDataLengthBytes > xSpace )
+		{
+			xDataLengthBytes = xSpace;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xPublish = ( xDataLengthBytes != ( size_t ) 0 ) ? pdTRUE : pdFALSE;
+	}
+
+	if( xPublish != pdFALSE )
+	{
+		/* A zero length message only has its length to write. */
+		uxHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, uxHead );
+
+		/* The data must be in the buffer before the reader can see the new
+		head. */
+		portMEMORY_BARRIER();
+		pxStreamBuffer->uxHead = uxHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadFromBuffer( StreamBuffer_t * const pxStreamBuffer, void *pvRxData, size_t xBufferLengthBytes )
+{
+UBaseType_t uxTail, uxMessageLength;
+size_t xBytesAvailable, xCount = 0;
+BaseType_t xConsume = pdFALSE;
+
+	/* Only the reader moves uxTail.  uxHead is read once, the writer can only
+	add data after that, and the data up to it must not be read before it. */
+	uxTail = pxStreamBuffer->uxTail;
+	xBytesAvailable = prvBytesInBuffer( pxStreamBuffer, pxStreamBuffer->uxHead, uxTail );
+	portMEMORY_BARRIER();
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* The writer publishes a message with its length, so any data at all
+		means a whole message. */
+		if( xBytesAvailable != ( size_t ) 0 )
+		{
+			uxTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &uxMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, uxTail );
+
+			/* A message that does not fit pvRxData stays in the buffer,
+			length included. */
+			if( ( size_t ) uxMessageLength <= xBufferLengthBytes )
+			{
+				xCount = ( size_t ) uxMessageLength;
+				xConsume = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* Read as many bytes as are available and fit. */
+		if( xBufferLengthBytes < xBytesAvailable )
+		{
+			xCount = xBufferLengthBytes;
+		}
+		else
+		{
+			xCount = xBytesAvailable;
+		}
+
+		xConsume = ( xCount != ( size_t ) 0 ) ? pdTRUE : pdFALSE;
+	}
+
+	if( xConsume != pdFALSE )
+	{
+		if( xCount != ( size_t ) 0 )
+		{
+			uxTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, uxTail );
+		}
+		else
+		{
+			/* Only the length of a zero length message was read. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The data must be copied out before the writer can reuse the
+		space. */
+		portMEMORY_BARRIER();
+		pxStreamBuffer->uxTail = uxTail;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, UBaseType_t uxHead )
+{
+size_t xFirstLength;
+
+	/* Calculate the number of bytes that can be added in the first write -
+	which may be less than the total number of bytes that need to be added if
+	the buffer will wrap back to the beginning. */
+	xFirstLength = ( size_t ) pxStreamBuffer->uxLength - ( size_t ) uxHead;
+	if( xFirstLength > xCount )
+	{
+		xFirstLength = xCount;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Write as many bytes as can be written in the first write. */
+	( void ) memcpy( ( void* ) ( &( pxStreamBuffer->pucBuffer[ uxHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+	/* If the number of bytes written was less than the number that could be
+	written in the first write... */
+	if( xCount > xFirstLength )
+	{
+		/* ...then write the remaining bytes to the start of the buffer. */
+		( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xCount += ( size_t ) uxHead;
+	if( xCount >= ( size_t ) pxStreamBuffer->uxLength )
+	{
+		xCount -= ( size_t ) pxStreamBuffer->uxLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( UBaseType_t ) xCount;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvReadBytesFromBuffer( const StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount, UBaseType_t uxTail )
+{
+size_t xFirstLength;
+
+	/* Calculate how much to read from the buffer before wrapping. */
+	xFirstLength = ( size_t ) pxStreamBuffer->uxLength - ( size_t ) uxTail;
+	if( xFirstLength > xCount )
+	{
+		xFirstLength = xCount;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Obtain the number of bytes it is possible to obtain in the first
+	read. */
+	( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ uxTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+	/* One or two reads required? */
+	if( xCount > xFirstLength )
+	{
+		/* Read the remaining bytes from the start of the buffer. */
+		( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( const void * ) pxStreamBuffer->pucBuffer, xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xCount += ( size_t ) uxTail;
+	if( xCount >= ( size_t ) pxStreamBuffer->uxLength )
+	{
+		xCount -= ( size_t ) pxStreamBuffer->uxLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( UBaseType_t ) xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer, UBaseType_t uxHead, UBaseType_t uxTail )
+{
+/* Returns the distance between uxTail and uxHead. */
+size_t xCount;
+
+	xCount = ( size_t ) pxStreamBuffer->uxLength + ( size_t ) uxHead - ( size_t ) uxTail;
+	if( xCount >= ( size_t ) pxStreamBuffer->uxLength )
+	{
+		xCount -= ( size_t ) pxStreamBuffer->uxLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSpacesInBuffer( const StreamBuffer_t * const pxStreamBuffer, UBaseType_t uxHead, UBaseType_t uxTail )
+{
+/* One byte is always left free, so a full buffer has uxHead just behind
+uxTail. */
+	return ( ( size_t ) pxStreamBuffer->uxLength - ( size_t ) 1 ) - prvBytesInBuffer( pxStreamBuffer, uxHead, uxTail );
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitingTask( volatile UBaseType_t * const puxWaiting, TaskHandle_t * const pxTask )
+{
+TaskHandle_t xTaskToNotify = NULL;
+
+	/* The fast path, nothing is masked when no task is waiting. */
+	if( *puxWaiting != ( UBaseType_t ) pdFALSE )
+	{
+		/* The handle is more than one byte, so it is read with the flag
+		inside a critical section in case the waiting task timed out and
+		cleared the flag meanwhile. */
+		taskENTER_CRITICAL();
+		{
+			if( *puxWaiting != ( UBaseType_t ) pdFALSE )
+			{
+				xTaskToNotify = *pxTask;
+				*puxWaiting = ( UBaseType_t ) pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xTaskToNotify != NULL )
+		{
+			( void ) xTaskNotify( xTaskToNotify, ( uint32_t ) 0, eNoAction );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitingTaskFromISR( volatile UBaseType_t * const puxWaiting, TaskHandle_t * const pxTask, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+TaskHandle_t xTaskToNotify = NULL;
+UBaseType_t uxSavedInterruptStatus;
+
+	/* The fast path, nothing is masked when no task is waiting. */
+	if( *puxWaiting != ( UBaseType_t ) pdFALSE )
+	{
+		uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( *puxWaiting != ( UBaseType_t ) pdFALSE )
+			{
+				xTaskToNotify = *pxTask;
+				*puxWaiting = ( UBaseType_t ) pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( xTaskToNotify != NULL )
+		{
+			( void ) xTaskNotifyFromISR( xTaskToNotify, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer, uint8_t * const pucBuffer, size_t xBufferSizeBytes, size_t xTriggerLevelBytes, uint8_t ucFlags )
+{
+	/* A trigger level of 0 would unblock a reader before there is anything
+	to read, and message buffers unblock the reader on every message. */
+	if( ( xTriggerLevelBytes == ( size_t ) 0 ) || ( ( ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 ) )
+	{
+		xTriggerLevelBytes = ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) ); /*lint !e9087 memset() requires void *. */
+	pxStreamBuffer->pucBuffer = pucBuffer;
+	pxStreamBuffer->uxLength = ( UBaseType_t ) ( xBufferSizeBytes + ( size_t ) 1 );
+	pxStreamBuffer->uxTriggerLevelBytes = ( UBaseType_t ) xTriggerLevelBytes;
+	pxStreamBuffer->ucFlags = ucFlags;
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include stream buffer functionality.  If you want to include stream and
+message buffers then ensure configUSE_STREAM_BUFFERS is set to 1 in
+FreeRTOSConfig.h. */
+#endif /* configUSE_STREAM_BUFFERS == 1 */
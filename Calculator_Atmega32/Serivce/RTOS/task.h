@@ -1629,6 +1629,31 @@ void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unquali
  */
 void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/**
+ * task. h
+ * <PRE>uint32_t ulTaskGetRunTimeCounter( const TaskHandle_t xTask );</PRE>
+ * <PRE>uint32_t ulTaskGetRunTimePercent( const TaskHandle_t xTask );</PRE>
+ *
+ * configGENERATE_RUN_TIME_STATS must be defined as 1 for these functions to be
+ * available.
+ *
+ * ulTaskGetRunTimeCounter() returns the total run time allocated to xTask so
+ * far, in run time stats clock counts.  ulTaskGetRunTimePercent() returns the
+ * same time as a percentage of the total run time since the scheduler started.
+ * Neither function formats text, so both are cheap enough to call from a task
+ * that reports the figures itself.  Time a task spends in a busy wait, such as
+ * a _delay_ms() loop, is counted as run time of that task.
+ *
+ * @param xTask Handle of the task being queried.  Passing NULL queries the
+ * calling task.  The time of the slice the queried task is currently executing
+ * is not included until the task is switched out.
+ *
+ * \defgroup ulTaskGetRunTimeCounter ulTaskGetRunTimeCounter
+ * \ingroup TaskUtils
+ */
+uint32_t ulTaskGetRunTimeCounter( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+uint32_t ulTaskGetRunTimePercent( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
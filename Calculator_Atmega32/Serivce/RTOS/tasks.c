@@ -82,6 +82,11 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "StackMacros.h"
 
+/* The idle task runs the co-routines, see prvGetExpectedIdleTime(). */
+#if ( configUSE_CO_ROUTINES == 1 )
+	#include "croutine.h"
+#endif
+
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
 header files above, but not in this file, in order to generate the correct
@@ -234,21 +239,53 @@ a statically allocated stack and a dynamically allocated TCB. */
 
 /*-----------------------------------------------------------*/
 
-/* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
-count overflows. */
-#define taskSWITCH_DELAYED_LISTS()																	\
-{																									\
-	List_t *pxTemp;																					\
-																									\
-	/* The delayed tasks list should be empty when the lists are switched. */						\
-	configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );										\
-																									\
-	pxTemp = pxDelayedTaskList;																		\
-	pxDelayedTaskList = pxOverflowDelayedTaskList;													\
-	pxOverflowDelayedTaskList = pxTemp;																\
-	xNumOfOverflows++;																				\
-	prvResetNextTaskUnblockTime();																	\
-}
+#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+
+	/* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
+	count overflows. */
+	#define taskSWITCH_DELAYED_LISTS()																	\
+	{																									\
+		List_t *pxTemp;																					\
+																										\
+		/* The delayed tasks list should be empty when the lists are switched. */						\
+		configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );										\
+																										\
+		pxTemp = pxDelayedTaskList;																		\
+		pxDelayedTaskList = pxOverflowDelayedTaskList;													\
+		pxOverflowDelayedTaskList = pxTemp;																\
+		xNumOfOverflows++;																				\
+		prvResetNextTaskUnblockTime();																	\
+	}
+
+	/* Returns pdTRUE if pxList is one of the lists that hold Blocked tasks. */
+	#define taskLIST_IS_DELAYED( pxList ) ( ( ( pxList ) == pxDelayedTaskList ) || ( ( pxList ) == pxOverflowDelayedTaskList ) )
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
+	/* The delayed tasks are held in a hierarchical timing wheel rather than a
+	list sorted by wake time.  Each level has taskWHEEL_SLOTS slots and is
+	indexed by the next configDELAYED_TASK_WHEEL_BITS bits of the wake time, so
+	a level 0 slot holds the tasks that wake on one particular tick and a level
+	n slot holds the tasks that wake within one revolution of level n - 1.
+	When a level wraps to slot 0 the current slot of the level above is
+	cascaded down.  As the slots are indexed by the absolute wake time the
+	wheel takes care of the tick count overflowing itself - there is no
+	overflow list to switch, only xNumOfOverflows needs updating. */
+	#define taskWHEEL_SLOTS			( 1U << configDELAYED_TASK_WHEEL_BITS )
+	#define taskWHEEL_SLOT_MASK		( ( TickType_t ) ( taskWHEEL_SLOTS - 1U ) )
+	#define taskWHEEL_LEVELS		( ( sizeof( TickType_t ) * 8U ) / configDELAYED_TASK_WHEEL_BITS )
+	#define taskWHEEL_LISTS			( taskWHEEL_LEVELS * taskWHEEL_SLOTS )
+	#define taskWHEEL_SLOT( uxLevel, xSlot ) ( &( xDelayedTaskWheel[ ( ( uxLevel ) << configDELAYED_TASK_WHEEL_BITS ) + ( xSlot ) ] ) )
+
+	#define taskSWITCH_DELAYED_LISTS()																	\
+	{																									\
+		xNumOfOverflows++;																				\
+	}
+
+	/* Returns pdTRUE if pxList is one of the lists that hold Blocked tasks. */
+	#define taskLIST_IS_DELAYED( pxList ) ( ( ( pxList ) >= &( xDelayedTaskWheel[ 0 ] ) ) && ( ( pxList ) <= &( xDelayedTaskWheel[ taskWHEEL_LISTS - 1U ] ) ) )
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 /*-----------------------------------------------------------*/
 
@@ -373,10 +410,18 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
 
 /* Lists for ready and blocked tasks. --------------------*/
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+
+	PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
+	PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
+	PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#else
+
+	PRIVILEGED_DATA static List_t xDelayedTaskWheel[ taskWHEEL_LISTS ];		/*< Delayed tasks, see taskWHEEL_SLOTS. */
+
+#endif
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if( INCLUDE_vTaskDelete == 1 )
@@ -550,6 +595,24 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/*
+	 * Place a list item whose value is already set to the wake time into the
+	 * wheel slot that will be serviced next for that wake time, as seen from
+	 * xReferenceTick.
+	 */
+	static void prvInsertIntoDelayedTaskWheel( ListItem_t * const pxListItem, const TickType_t xReferenceTick ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called from the tick interrupt when level 0 of the wheel wraps.  Moves
+	 * the tasks held in the current slot of each wrapping level one or more
+	 * levels down.
+	 */
+	static void prvCascadeDelayedTaskWheel( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -1287,7 +1350,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
+			if( taskLIST_IS_DELAYED( pxStateList ) )
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -2005,7 +2068,28 @@ void vTaskSuspendAll( void )
 		}
 		else
 		{
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+			{
+				/* The wheel does not track the next unblock time as tasks
+				are added to it, so work it out now. */
+				prvResetNextTaskUnblockTime();
+			}
+			#endif
+
 			xReturn = xNextTaskUnblockTime - xTickCount;
+
+			#if( configUSE_CO_ROUTINES == 1 )
+			{
+				/* Co-routines run from the idle task hook, so the idle task
+				must also wake in time for the next co-routine delay. */
+				TickType_t xCoRoutineIdleTime = xCoRoutineGetExpectedIdleTime();
+
+				if( xCoRoutineIdleTime < xReturn )
+				{
+					xReturn = xCoRoutineIdleTime;
+				}
+			}
+			#endif
 		}
 
 		return xReturn;
@@ -2278,15 +2362,26 @@ TCB_t *pxTCB;
 			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
 			/* Search the delayed lists. */
-			if( pxTCB == NULL )
+			#if( configUSE_DELAYED_TASK_WHEEL == 0 )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-			}
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				}
 
-			if( pxTCB == NULL )
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				}
+			}
+			#else
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				for( uxQueue = ( UBaseType_t ) 0U; ( uxQueue < taskWHEEL_LISTS ) && ( pxTCB == NULL ); uxQueue++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheel[ uxQueue ] ), pcNameToQuery );
+				}
 			}
+			#endif
 
 			#if ( INCLUDE_vTaskSuspend == 1 )
 			{
@@ -2338,8 +2433,19 @@ TCB_t *pxTCB;
 
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+				{
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				}
+				#else
+				{
+					for( uxQueue = ( UBaseType_t ) 0U; uxQueue < taskWHEEL_LISTS; uxQueue++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxQueue ] ), eBlocked );
+					}
+				}
+				#endif
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -2414,7 +2520,18 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 		/* Correct the tick count value after a period during which the tick
 		was suppressed.  Note this does *not* call the tick hook function for
 		each stepped tick. */
-		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+		#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+		{
+			configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+		}
+		#else
+		{
+			/* The tick at xNextTaskUnblockTime must be processed by
+			xTaskIncrementTick() or the wheel slot it services would be
+			skipped. */
+			configASSERT( ( xTickCount + xTicksToJump ) < xNextTaskUnblockTime );
+		}
+		#endif
 		xTickCount += xTicksToJump;
 		traceINCREASE_TICK_COUNT( xTicksToJump );
 	}
@@ -2499,8 +2616,12 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 BaseType_t xTaskIncrementTick( void )
 {
 TCB_t * pxTCB;
-TickType_t xItemValue;
 BaseType_t xSwitchRequired = pdFALSE;
+#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	TickType_t xItemValue;
+#else
+	List_t *pxWheelSlot;
+#endif
 
 	/* Called by the portable layer each time a tick interrupt occurs.
 	Increments the tick then checks to see if the new tick value will cause any
@@ -2525,87 +2646,146 @@ BaseType_t xSwitchRequired = pdFALSE;
 			mtCOVERAGE_TEST_MARKER();
 		}
 
-		/* See if this tick has made a timeout expire.  Tasks are stored in
-		the	queue in the order of their wake time - meaning once one task
-		has been found whose block time has not expired there is no need to
-		look any further down the list. */
-		if( xConstTickCount >= xNextTaskUnblockTime )
+		#if( configUSE_DELAYED_TASK_WHEEL == 0 )
 		{
-			for( ;; )
+			/* See if this tick has made a timeout expire.  Tasks are stored in
+			the	queue in the order of their wake time - meaning once one task
+			has been found whose block time has not expired there is no need to
+			look any further down the list. */
+			if( xConstTickCount >= xNextTaskUnblockTime )
 			{
-				if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+				for( ;; )
 				{
-					/* The delayed list is empty.  Set xNextTaskUnblockTime
-					to the maximum possible value so it is extremely
-					unlikely that the
-					if( xTickCount >= xNextTaskUnblockTime ) test will pass
-					next time through. */
-					xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					break;
-				}
-				else
-				{
-					/* The delayed list is not empty, get the value of the
-					item at the head of the delayed list.  This is the time
-					at which the task at the head of the delayed list must
-					be removed from the Blocked state. */
-					pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-					xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
-
-					if( xConstTickCount < xItemValue )
+					if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
 					{
-						/* It is not time to unblock this item yet, but the
-						item value is the time at which the task at the head
-						of the blocked list must be removed from the Blocked
-						state -	so record the item value in
-						xNextTaskUnblockTime. */
-						xNextTaskUnblockTime = xItemValue;
+						/* The delayed list is empty.  Set xNextTaskUnblockTime
+						to the maximum possible value so it is extremely
+						unlikely that the
+						if( xTickCount >= xNextTaskUnblockTime ) test will pass
+						next time through. */
+						xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 						break;
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-
-					/* It is time to remove the item from the Blocked state. */
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-
-					/* Is the task waiting on an event also?  If so remove
-					it from the event list. */
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-					{
-						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+						/* The delayed list is not empty, get the value of the
+						item at the head of the delayed list.  This is the time
+						at which the task at the head of the delayed list must
+						be removed from the Blocked state. */
+						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+						if( xConstTickCount < xItemValue )
+						{
+							/* It is not time to unblock this item yet, but the
+							item value is the time at which the task at the head
+							of the blocked list must be removed from the Blocked
+							state -	so record the item value in
+							xNextTaskUnblockTime. */
+							xNextTaskUnblockTime = xItemValue;
+							break;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
 
-					/* Place the unblocked task into the appropriate ready
-					list. */
-					prvAddTaskToReadyList( pxTCB );
+						/* It is time to remove the item from the Blocked state. */
+						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
 
-					/* A task being unblocked cannot cause an immediate
-					context switch if preemption is turned off. */
-					#if (  configUSE_PREEMPTION == 1 )
-					{
-						/* Preemption is on, but a context switch should
-						only be performed if the unblocked task has a
-						priority that is equal to or higher than the
-						currently executing task. */
-						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						/* Is the task waiting on an event also?  If so remove
+						it from the event list. */
+						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
 						{
-							xSwitchRequired = pdTRUE;
+							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
 						}
 						else
 						{
 							mtCOVERAGE_TEST_MARKER();
 						}
+
+						/* Place the unblocked task into the appropriate ready
+						list. */
+						prvAddTaskToReadyList( pxTCB );
+
+						/* A task being unblocked cannot cause an immediate
+						context switch if preemption is turned off. */
+						#if (  configUSE_PREEMPTION == 1 )
+						{
+							/* Preemption is on, but a context switch should
+							only be performed if the unblocked task has a
+							priority that is equal to or higher than the
+							currently executing task. */
+							if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+							{
+								xSwitchRequired = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_PREEMPTION */
 					}
-					#endif /* configUSE_PREEMPTION */
 				}
 			}
 		}
+		#else /* configUSE_DELAYED_TASK_WHEEL */
+		{
+			/* When level 0 of the wheel wraps the higher levels may hold tasks
+			that are now close enough to their wake time to move down. */
+			if( ( xConstTickCount & taskWHEEL_SLOT_MASK ) == ( TickType_t ) 0U )
+			{
+				prvCascadeDelayedTaskWheel( xConstTickCount );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Every task in the level 0 slot for this tick has reached its
+			wake time, so the slot is emptied without looking at the item
+			values. */
+			pxWheelSlot = taskWHEEL_SLOT( 0U, xConstTickCount & taskWHEEL_SLOT_MASK );
+
+			while( listLIST_IS_EMPTY( pxWheelSlot ) == pdFALSE )
+			{
+				pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxWheelSlot );
+
+				/* It is time to remove the item from the Blocked state. */
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+				/* Is the task waiting on an event also?  If so remove it from
+				the event list. */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Place the unblocked task into the appropriate ready list. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task being unblocked cannot cause an immediate context
+				switch if preemption is turned off. */
+				#if (  configUSE_PREEMPTION == 1 )
+				{
+					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+		}
+		#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
@@ -3212,6 +3392,11 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 					configASSERT( xNextTaskUnblockTime >= xTickCount );
 					xExpectedIdleTime = prvGetExpectedIdleTime();
 
+					/* Define the following macro to shorten the sleep, or to
+					set xExpectedIdleTime to 0 if the application does not
+					want portSUPPRESS_TICKS_AND_SLEEP() to be called. */
+					configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
+
 					if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
 					{
 						traceLOW_POWER_IDLE_BEGIN();
@@ -3339,8 +3524,22 @@ UBaseType_t uxPriority;
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#else
+	{
+	UBaseType_t uxSlot;
+
+		for( uxSlot = ( UBaseType_t ) 0U; uxSlot < taskWHEEL_LISTS; uxSlot++ )
+		{
+			vListInitialise( &( xDelayedTaskWheel[ uxSlot ] ) );
+		}
+	}
+	#endif
+
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -3355,10 +3554,14 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		/* Start with pxDelayedTaskList using list1 and the
+		pxOverflowDelayedTaskList using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
@@ -3632,6 +3835,8 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
+#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+
 static void prvResetNextTaskUnblockTime( void )
 {
 TCB_t *pxTCB;
@@ -3654,6 +3859,121 @@ TCB_t *pxTCB;
 		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
 	}
 }
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
+static void prvResetNextTaskUnblockTime( void )
+{
+const TickType_t xConstTickCount = xTickCount;
+TickType_t xTicksToNextSlot = portMAX_DELAY, xTicks, xBoundary, xBoundarySlot;
+UBaseType_t uxLevel, uxSlot, uxShift = 0U;
+
+	/* The wheel is not sorted, so find the nearest tick at which a slot that
+	holds tasks is either emptied (level 0) or cascaded (higher levels).
+	Nothing happens to the wheel before that tick, so it is the next unblock
+	time as far as stepping the tick count is concerned.  This takes a fixed
+	number of steps however many tasks are Blocked. */
+	for( uxLevel = ( UBaseType_t ) 0U; uxLevel < taskWHEEL_LEVELS; uxLevel++ )
+	{
+		/* The first tick after now at which this level moves on a slot, and
+		the slot it moves on to. */
+		xBoundary = ( xConstTickCount | ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U ) ) + ( TickType_t ) 1U;
+		xBoundarySlot = ( xBoundary >> uxShift ) & taskWHEEL_SLOT_MASK;
+
+		for( uxSlot = ( UBaseType_t ) 0U; uxSlot < taskWHEEL_SLOTS; uxSlot++ )
+		{
+			if( listLIST_IS_EMPTY( taskWHEEL_SLOT( uxLevel, uxSlot ) ) == pdFALSE )
+			{
+				xTicks = ( xBoundary - xConstTickCount ) + ( ( ( ( TickType_t ) uxSlot - xBoundarySlot ) & taskWHEEL_SLOT_MASK ) << uxShift );
+
+				if( xTicks < xTicksToNextSlot )
+				{
+					xTicksToNextSlot = xTicks;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		uxShift += ( UBaseType_t ) configDELAYED_TASK_WHEEL_BITS;
+	}
+
+	/* As with the sorted lists, never report a time beyond the tick count
+	overflowing - the overflow itself must always be processed by
+	xTaskIncrementTick().  This also covers the wheel being empty. */
+	if( xTicksToNextSlot > ( portMAX_DELAY - xConstTickCount ) )
+	{
+		xNextTaskUnblockTime = portMAX_DELAY;
+	}
+	else
+	{
+		xNextTaskUnblockTime = xConstTickCount + xTicksToNextSlot;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertIntoDelayedTaskWheel( ListItem_t * const pxListItem, const TickType_t xReferenceTick )
+{
+const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( pxListItem );
+const TickType_t xTicksToWake = xTimeToWake - xReferenceTick;
+UBaseType_t uxLevel = ( UBaseType_t ) 0U, uxShift = ( UBaseType_t ) 0U;
+
+	/* Find the lowest level that spans the time remaining.  The top level
+	spans the whole range of TickType_t so the shift never reaches the width
+	of the type. */
+	while( ( xTicksToWake >> uxShift ) >= ( TickType_t ) taskWHEEL_SLOTS )
+	{
+		uxShift += ( UBaseType_t ) configDELAYED_TASK_WHEEL_BITS;
+		uxLevel++;
+	}
+
+	vListInsertEnd( taskWHEEL_SLOT( uxLevel, ( xTimeToWake >> uxShift ) & taskWHEEL_SLOT_MASK ), pxListItem );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCascadeDelayedTaskWheel( const TickType_t xConstTickCount )
+{
+List_t *pxWheelSlot;
+ListItem_t *pxListItem;
+TickType_t xSlot;
+UBaseType_t uxLevel, uxShift = ( UBaseType_t ) configDELAYED_TASK_WHEEL_BITS;
+
+	for( uxLevel = ( UBaseType_t ) 1U; uxLevel < taskWHEEL_LEVELS; uxLevel++ )
+	{
+		/* Every task in the slot that has just become current on this level
+		wakes within one revolution of the level below, so re-inserting it
+		places it at a lower level. */
+		xSlot = ( xConstTickCount >> uxShift ) & taskWHEEL_SLOT_MASK;
+		pxWheelSlot = taskWHEEL_SLOT( uxLevel, xSlot );
+
+		while( listLIST_IS_EMPTY( pxWheelSlot ) == pdFALSE )
+		{
+			pxListItem = listGET_HEAD_ENTRY( pxWheelSlot );
+			( void ) uxListRemove( pxListItem );
+			prvInsertIntoDelayedTaskWheel( pxListItem, xConstTickCount );
+		}
+
+		/* Only carry on up if this level has wrapped too. */
+		if( xSlot != ( TickType_t ) 0U )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxShift += ( UBaseType_t ) configDELAYED_TASK_WHEEL_BITS;
+	}
+}
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
@@ -4159,6 +4479,60 @@ TCB_t *pxTCB;
 #endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	uint32_t ulTaskGetRunTimeCounter( const TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	uint32_t ulReturn;
+
+		/* The counter is 32 bits so cannot be read atomically on an 8 or 16
+		bit architecture. */
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+			ulReturn = pxTCB->ulRunTimeCounter;
+		}
+		taskEXIT_CRITICAL();
+
+		return ulReturn;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	uint32_t ulTaskGetRunTimePercent( const TaskHandle_t xTask )
+	{
+	uint32_t ulTotalTime, ulReturn;
+
+		#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+			portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalTime );
+		#else
+			ulTotalTime = portGET_RUN_TIME_COUNTER_VALUE();
+		#endif
+
+		/* Divide the total first to get a percentage without the risk of the
+		multiplication overflowing. */
+		ulTotalTime /= 100UL;
+
+		/* Avoid divide by zero errors. */
+		if( ulTotalTime > 0UL )
+		{
+			ulReturn = ulTaskGetRunTimeCounter( xTask ) / ulTotalTime;
+		}
+		else
+		{
+			ulReturn = 0UL;
+		}
+
+		return ulReturn;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
 TickType_t uxTaskResetEventItemValue( void )
 {
 TickType_t uxReturn;
@@ -4735,6 +5109,55 @@ const TickType_t xConstTickCount = xTickCount;
 			/* The list item will be inserted in wake time order. */
 			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+			#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+			{
+				if( xTimeToWake < xConstTickCount )
+				{
+					/* Wake time has overflowed.  Place this item in the
+					overflow list. */
+					vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				}
+				else
+				{
+					/* The wake time has not overflowed, so the current block
+					list is used. */
+					vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+					/* If the task entering the blocked state was placed at the
+					head of the list of blocked tasks then xNextTaskUnblockTime
+					needs to be updated too. */
+					if( xTimeToWake < xNextTaskUnblockTime )
+					{
+						xNextTaskUnblockTime = xTimeToWake;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			#else
+			{
+				/* The current tick has already been processed, so a zero
+				block time would not be seen until the tick count wrapped. */
+				configASSERT( xTicksToWait > ( TickType_t ) 0U );
+				prvInsertIntoDelayedTaskWheel( &( pxCurrentTCB->xStateListItem ), xConstTickCount );
+			}
+			#endif
+		}
+	}
+	#else /* INCLUDE_vTaskSuspend */
+	{
+		/* Calculate the time at which the task should be woken if the event
+		does not occur.  This may overflow but this doesn't matter, the kernel
+		will manage it correctly. */
+		xTimeToWake = xConstTickCount + xTicksToWait;
+
+		/* The list item will be inserted in wake time order. */
+		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+
+		#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+		{
 			if( xTimeToWake < xConstTickCount )
 			{
 				/* Wake time has overflowed.  Place this item in the overflow
@@ -4760,39 +5183,12 @@ const TickType_t xConstTickCount = xTickCount;
 				}
 			}
 		}
-	}
-	#else /* INCLUDE_vTaskSuspend */
-	{
-		/* Calculate the time at which the task should be woken if the event
-		does not occur.  This may overflow but this doesn't matter, the kernel
-		will manage it correctly. */
-		xTimeToWake = xConstTickCount + xTicksToWait;
-
-		/* The list item will be inserted in wake time order. */
-		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
-
-		if( xTimeToWake < xConstTickCount )
-		{
-			/* Wake time has overflowed.  Place this item in the overflow list. */
-			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-		}
-		else
+		#else
 		{
-			/* The wake time has not overflowed, so the current block list is used. */
-			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-
-			/* If the task entering the blocked state was placed at the head of the
-			list of blocked tasks then xNextTaskUnblockTime needs to be updated
-			too. */
-			if( xTimeToWake < xNextTaskUnblockTime )
-			{
-				xNextTaskUnblockTime = xTimeToWake;
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			configASSERT( xTicksToWait > ( TickType_t ) 0U );
+			prvInsertIntoDelayedTaskWheel( &( pxCurrentTCB->xStateListItem ), xConstTickCount );
 		}
+		#endif
 
 		/* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
 		( void ) xCanBlockIndefinitely;
@@ -0,0 +1,20 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: Trace configuration file   ******************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef TRACE_CNFIG_H_
+#define TRACE_CNFIG_H_
+
+/**
+*	Number of records in the RAM ring buffer, each one is 4 bytes.
+*	Options:
+			power of two from 2 to 128
+*/
+#define TRACE_BUFFER_RECORDS	32
+
+
+#endif /* TRACE_CNFIG_H_ */
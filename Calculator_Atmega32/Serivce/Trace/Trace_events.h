@@ -0,0 +1,54 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: Trace record format, shared with   **********/
+/****************************              Tools/TraceDecoder               ************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef TRACE_EVENTS_H_
+#define TRACE_EVENTS_H_
+
+/*
+* Every record is 4 bytes:
+*	byte 0		high nibble event code, low nibble object (task or queue) number
+*	byte 1		event argument
+*	byte 2,3	time stamp, little endian, low 16 bits of the run time stats clock
+*
+* TRACE_voidDrain() sends the records in frames:
+*	TRACE_FRAME_SYNC, record count, records lost since the previous frame, records
+*
+* Task numbers are the kernel's uxTCBNumber (1 for the first task created) and
+* queue numbers are given in creation order starting from 1.  Only the low
+* nibble of either is recorded.
+*/
+#define TRACE_RECORD_SIZE				4
+#define TRACE_FRAME_SYNC				0xA5
+#define TRACE_OBJECT_MASK				0x0F
+
+/*Object: task, argument: task priority*/
+#define TRACE_EVT_TASK_SWITCHED_IN		0
+#define TRACE_EVT_TASK_CREATE			1
+/*Object: task*/
+#define TRACE_EVT_TASK_READY			2
+#define TRACE_EVT_TASK_DELAY			3
+/*Sent every 64 ticks so time stamps, which wrap every 65536 counts (262ms at 4us), can be
+  unwrapped with margin.  Object: tick count bits 15..14, argument: bits 13..6*/
+#define TRACE_EVT_TICK					4
+#define TRACE_TICK_MARKER_SHIFT			6
+/*Ticks stepped after tickless idle, object is bits 11..8 and argument bits 7..0*/
+#define TRACE_EVT_TICK_STEP				5
+/*Object: queue, argument: queue length*/
+#define TRACE_EVT_QUEUE_CREATE			6
+/*Object: queue, argument: messages waiting before the operation*/
+#define TRACE_EVT_QUEUE_SEND			7
+#define TRACE_EVT_QUEUE_SEND_FAILED		8
+#define TRACE_EVT_QUEUE_RECEIVE			9
+#define TRACE_EVT_QUEUE_RECEIVE_FAILED	10
+#define TRACE_EVT_QUEUE_BLOCK_SEND		11
+#define TRACE_EVT_QUEUE_BLOCK_RECEIVE	12
+#define TRACE_EVT_QUEUE_SEND_FROM_ISR	13
+#define TRACE_EVT_QUEUE_RECEIVE_FROM_ISR	14
+
+#endif /* TRACE_EVENTS_H_ */
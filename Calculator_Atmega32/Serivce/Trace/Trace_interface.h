@@ -0,0 +1,78 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: Trace Functions interface file   ************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef TRACE_INTERFACE_H_
+#define TRACE_INTERFACE_H_
+
+#include "StdTypes.h"
+#include "Trace_events.h"
+
+/**
+* @brief: initialize the UART used to send the records.
+*/
+extern void TRACE_voidInit(void);
+/**
+* @brief: add one time stamped record to the ring buffer, the record is
+*		  counted as lost if the buffer is full.  Safe to call from interrupts.
+* @Param: Copy_u8Event		TRACE_EVT_ code.
+* @Param: Copy_u8Object		task or queue number.
+* @Param: Copy_u8Argument	event argument, see Trace_events.h.
+*/
+extern void TRACE_voidRecord(u8 Copy_u8Event,u8 Copy_u8Object,u8 Copy_u8Argument);
+/**
+* @brief: give a new queue its number and record its creation.
+* @Param: Copy_u8Length		queue length.
+* @return: queue number.
+*/
+extern u8 TRACE_u8QueueCreate(u8 Copy_u8Length);
+/**
+* @brief: send every buffered record over the UART, polling.  Meant to be
+*		  called from the idle task hook so tracing only uses spare time.
+*/
+extern void TRACE_voidDrain(void);
+
+
+/****************************** Kernel trace hooks ***********************************/
+/*
+* Included at the end of FreeRTOSConfig.h, so these replace the empty defaults
+* in FreeRTOS.h.  They expand inside tasks.c and queue.c, which is where the
+* TCB and queue members used below are visible.
+*/
+#if configUSE_TRACE_FACILITY != 1
+	#error The trace recorder needs configUSE_TRACE_FACILITY set to 1 for task and queue numbers
+#endif
+#if configGENERATE_RUN_TIME_STATS != 1
+	#error The trace recorder needs configGENERATE_RUN_TIME_STATS set to 1 for time stamps
+#endif
+#if configUSE_IDLE_HOOK != 1
+	#error The trace recorder needs configUSE_IDLE_HOOK set to 1 to drain the records
+#endif
+
+#define traceTASK_SWITCHED_IN()					TRACE_voidRecord(TRACE_EVT_TASK_SWITCHED_IN,(u8)pxCurrentTCB->uxTCBNumber,(u8)pxCurrentTCB->uxPriority)
+#define traceTASK_CREATE(pxNewTCB)				TRACE_voidRecord(TRACE_EVT_TASK_CREATE,(u8)(pxNewTCB)->uxTCBNumber,(u8)(pxNewTCB)->uxPriority)
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)	TRACE_voidRecord(TRACE_EVT_TASK_READY,(u8)(pxTCB)->uxTCBNumber,0)
+#define traceTASK_DELAY()						TRACE_voidRecord(TRACE_EVT_TASK_DELAY,(u8)pxCurrentTCB->uxTCBNumber,0)
+#define traceTASK_DELAY_UNTIL(xTimeToWake)		TRACE_voidRecord(TRACE_EVT_TASK_DELAY,(u8)pxCurrentTCB->uxTCBNumber,0)
+
+/*xTickCount is the value before the increment*/
+#define traceTASK_INCREMENT_TICK(xTickCount)	((0 == (((xTickCount) + 1) & ((1 << TRACE_TICK_MARKER_SHIFT) - 1))) ? \
+													TRACE_voidRecord(TRACE_EVT_TICK,(u8)((u16)((xTickCount) + 1) >> 14),(u8)(((xTickCount) + 1) >> TRACE_TICK_MARKER_SHIFT)) : (void)0)
+#define traceINCREASE_TICK_COUNT(xTicksToJump)	TRACE_voidRecord(TRACE_EVT_TICK_STEP,(u8)((xTicksToJump) >> 8),(u8)(xTicksToJump))
+
+#define traceQUEUE_CREATE(pxNewQueue)			((pxNewQueue)->uxQueueNumber = TRACE_u8QueueCreate((u8)(pxNewQueue)->uxLength))
+#define traceQUEUE_SEND(pxQueue)				TRACE_voidRecord(TRACE_EVT_QUEUE_SEND,(u8)(pxQueue)->uxQueueNumber,(u8)(pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_SEND_FAILED(pxQueue)			TRACE_voidRecord(TRACE_EVT_QUEUE_SEND_FAILED,(u8)(pxQueue)->uxQueueNumber,(u8)(pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_RECEIVE(pxQueue)				TRACE_voidRecord(TRACE_EVT_QUEUE_RECEIVE,(u8)(pxQueue)->uxQueueNumber,(u8)(pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_RECEIVE_FAILED(pxQueue)		TRACE_voidRecord(TRACE_EVT_QUEUE_RECEIVE_FAILED,(u8)(pxQueue)->uxQueueNumber,(u8)(pxQueue)->uxMessagesWaiting)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)	TRACE_voidRecord(TRACE_EVT_QUEUE_BLOCK_SEND,(u8)(pxQueue)->uxQueueNumber,(u8)(pxQueue)->uxMessagesWaiting)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)	TRACE_voidRecord(TRACE_EVT_QUEUE_BLOCK_RECEIVE,(u8)(pxQueue)->uxQueueNumber,(u8)(pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)		TRACE_voidRecord(TRACE_EVT_QUEUE_SEND_FROM_ISR,(u8)(pxQueue)->uxQueueNumber,(u8)(pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)	TRACE_voidRecord(TRACE_EVT_QUEUE_RECEIVE_FROM_ISR,(u8)(pxQueue)->uxQueueNumber,(u8)(pxQueue)->uxMessagesWaiting)
+
+
+#endif /* TRACE_INTERFACE_H_ */
@@ -0,0 +1,21 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Describtion: Trace Private header file   *****************/
+/***************************************************************************************/
+/***************************************************************************************/
+
+#ifndef TRACE_PRIVATE_H_
+#define TRACE_PRIVATE_H_
+
+typedef struct
+{
+	u8 u8Header;
+	u8 u8Argument;
+	u16 u16Time;
+}TRACE_Record_t;
+
+#define TRACE_BUFFER_MASK	((u8)(TRACE_BUFFER_RECORDS - 1))
+
+#endif /* TRACE_PRIVATE_H_ */
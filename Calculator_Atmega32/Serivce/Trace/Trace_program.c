@@ -0,0 +1,106 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Description: Trace Functions implementation file   *******/
+/***************************************************************************************/
+/***************************************************************************************/
+
+/************ Lib Includes ******************/
+#include "StdTypes.h"
+/************ Service layer Includes ********/
+#include "FreeRTOS.h"
+
+/*The module is only built when FreeRTOSConfig.h enables it, which is also
+  where Trace_interface.h gets included from so the kernel sees the hooks*/
+#if configUSE_TRACE_RECORDER == 1
+
+/************ MCAL Includes *****************/
+#include "UART_interface.h"
+
+/************ Trace Includes ****************/
+#include "Trace_interface.h"
+#include "Trace_private.h"
+#include "Trace_cnfig.h"
+
+#if ((TRACE_BUFFER_RECORDS & (TRACE_BUFFER_RECORDS - 1)) != 0) || (TRACE_BUFFER_RECORDS < 2) || (TRACE_BUFFER_RECORDS > 128)
+	#error TRACE_BUFFER_RECORDS must be a power of two from 2 to 128
+#endif
+/**************** End of Inclusion section *************************************/
+
+static TRACE_Record_t TRACE_axBuffer[TRACE_BUFFER_RECORDS];
+/*Free running indexes, the head is only written by TRACE_voidRecord and the
+  tail only by TRACE_voidDrain, so each side reads the other's with one load*/
+static volatile u8 TRACE_u8Head = ZERO_INIT;
+static volatile u8 TRACE_u8Tail = ZERO_INIT;
+static volatile u8 TRACE_u8Lost = ZERO_INIT;
+static u8 TRACE_u8QueueCount = ZERO_INIT;
+
+
+void TRACE_voidInit(void)
+{
+	UART_voidInit();
+}
+void TRACE_voidRecord(u8 Copy_u8Event,u8 Copy_u8Object,u8 Copy_u8Argument)
+{
+	TRACE_Record_t *Local_pxRecord;
+	u8 Local_u8Head;
+
+	portENTER_CRITICAL();
+	Local_u8Head = TRACE_u8Head;
+	if((u8)(Local_u8Head - TRACE_u8Tail) < TRACE_BUFFER_RECORDS)
+	{
+		Local_pxRecord = &TRACE_axBuffer[Local_u8Head & TRACE_BUFFER_MASK];
+		Local_pxRecord->u8Header = (u8)((Copy_u8Event << 4) | (Copy_u8Object & TRACE_OBJECT_MASK));
+		Local_pxRecord->u8Argument = Copy_u8Argument;
+		/*Inline timer read, interrupts are already off*/
+		Local_pxRecord->u16Time = usPortGetRunTimeCounterLow();
+		TRACE_u8Head = Local_u8Head + 1;
+	}
+	else if(TRACE_u8Lost < MAX_u8)
+	{
+		TRACE_u8Lost++;
+	}
+	portEXIT_CRITICAL();
+}
+u8 TRACE_u8QueueCreate(u8 Copy_u8Length)
+{
+	u8 Local_u8Queue;
+
+	portENTER_CRITICAL();
+	Local_u8Queue = ++TRACE_u8QueueCount;
+	portEXIT_CRITICAL();
+	TRACE_voidRecord(TRACE_EVT_QUEUE_CREATE,Local_u8Queue,Copy_u8Length);
+	return Local_u8Queue;
+}
+void TRACE_voidDrain(void)
+{
+	TRACE_Record_t *Local_pxRecord;
+	u8 Local_u8Count;
+	u8 Local_u8Lost;
+
+	portENTER_CRITICAL();
+	Local_u8Lost = TRACE_u8Lost;
+	TRACE_u8Lost = ZERO_INIT;
+	Local_u8Count = (u8)(TRACE_u8Head - TRACE_u8Tail);
+	portEXIT_CRITICAL();
+
+	if((Local_u8Count > 0) || (Local_u8Lost > 0))
+	{
+		UART_voidSendByte(TRACE_FRAME_SYNC);
+		UART_voidSendByte(Local_u8Count);
+		UART_voidSendByte(Local_u8Lost);
+		/*Records added while the frame is sent go in the next frame*/
+		for(;Local_u8Count > 0;Local_u8Count--)
+		{
+			Local_pxRecord = &TRACE_axBuffer[TRACE_u8Tail & TRACE_BUFFER_MASK];
+			UART_voidSendByte(Local_pxRecord->u8Header);
+			UART_voidSendByte(Local_pxRecord->u8Argument);
+			UART_voidSendByte((u8)Local_pxRecord->u16Time);
+			UART_voidSendByte((u8)(Local_pxRecord->u16Time >> 8));
+			TRACE_u8Tail++;
+		}
+	}
+}
+
+#endif /* configUSE_TRACE_RECORDER */
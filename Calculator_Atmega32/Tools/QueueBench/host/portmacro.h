@@ -0,0 +1,63 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Description: Host stand in for the AVR portmacro.h ******/
+/****************************              used by the queue benchmark       **********/
+/***************************************************************************************/
+/***************************************************************************************/
+/*
+Forced in ahead of everything else (gcc -include), so its include guard keeps
+Serivce/RTOS/portmacro.h out and queue.c builds with the application's
+FreeRTOSConfig.h and the same types as on the ATmega32 (8 bit UBaseType_t,
+16 bit ticks).  There is no scheduler and no interrupt, so the critical
+sections do nothing.
+*/
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+#include "FreeRTOSConfig.h"
+
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		int
+#define portSTACK_TYPE	uint8_t
+#define portBASE_TYPE	char
+
+typedef portSTACK_TYPE StackType_t;
+typedef signed char BaseType_t;
+typedef unsigned char UBaseType_t;
+
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+#endif
+
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			1
+#define portNOP()
+
+extern void vPortYield( void );
+#define portYIELD()					vPortYield()
+#define portMEMORY_BARRIER()		__asm volatile ( "" ::: "memory" )
+
+#if configGENERATE_RUN_TIME_STATS == 1
+	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+	#define portGET_RUN_TIME_COUNTER_VALUE()			0UL
+#endif
+
+
+#endif /* PORTMACRO_H */
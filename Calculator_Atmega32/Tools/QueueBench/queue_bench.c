@@ -0,0 +1,242 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Description: Cost of a queue send/receive pair per *****/
+/****************************              item size                             *****/
+/***************************************************************************************/
+/***************************************************************************************/
+/*
+queue.c is built into this file, so queues can be used without the scheduler.
+Each pair is an xQueueSend() then an xQueueReceive() with no block time, on a
+queue of length one that nothing waits on.  Build it twice and compare:
+with configUSE_QUEUE_COPY_ROUTINES set to 0 the items are copied by memcpy()
+called straight from queue.c, as the application builds it; with 1 by the
+routine queue.c picks for the item size, called through the queue.
+
+Build and run on Linux (host/portmacro.h stands in for the AVR port), the
+figures are time stamp counter ticks on x86 and nanoseconds elsewhere:
+	gcc -O2 -include host/portmacro.h -I../../Serivce/RTOS -DconfigUSE_QUEUE_COPY_ROUTINES=0
+		-o queue_bench_memcpy queue_bench.c ../../Serivce/RTOS/list.c
+	gcc -O2 -include host/portmacro.h -I../../Serivce/RTOS -DconfigUSE_QUEUE_COPY_ROUTINES=1
+		-o queue_bench_routines queue_bench.c ../../Serivce/RTOS/list.c
+	./queue_bench_memcpy; ./queue_bench_routines
+
+Build for the ATmega32, the figures are CPU cycles counted by timer 1 and are
+printed on the UART at UART_BAUD_RATE, again once with each setting:
+	avr-gcc -mmcu=atmega32 -Os -I../../Serivce/RTOS -I../../MCAL/UART -I../../Lib -DconfigUSE_QUEUE_COPY_ROUTINES=0
+		-o queue_bench.elf queue_bench.c ../../Serivce/RTOS/list.c ../../MCAL/UART/UART_program.c
+	avr-objcopy -O ihex queue_bench.elf queue_bench.hex
+*/
+
+#include "queue.c"
+
+#if defined( __AVR__ )
+	#include <avr/io.h>
+	#include "UART_interface.h"
+#else
+	#include <stdio.h>
+	#if defined( __x86_64__ ) || defined( __i386__ )
+		#include <x86intrin.h>
+	#else
+		#include <time.h>
+	#endif
+#endif
+
+/*Largest item timed and the pairs averaged per figure*/
+#define BENCH_MAX_ITEM_SIZE		32
+#if defined( __AVR__ )
+	#define BENCH_PAIRS			64UL
+#else
+	#define BENCH_PAIRS			200000UL
+#endif
+
+/*The application's items are 3 (equationMSG_t), 4 (equationResultMSG_t) and
+  10 bytes (time string), semaphores have none*/
+static const UBaseType_t Bench_uxSizes[] = { 1, 2, 3, 4, 8, 10, 16, 32 };
+
+static StaticQueue_t	Bench_xQueueBuffer;
+static uint8_t			Bench_ucQueueStorage[BENCH_MAX_ITEM_SIZE];
+static uint8_t			Bench_ucItem[BENCH_MAX_ITEM_SIZE];
+
+/*************** Timing ***************/
+
+static void Bench_vTimerInit(void)
+{
+#if defined( __AVR__ )
+	/*Timer 1 counts CPU cycles, there is no scheduler to use it for the tick*/
+	TCCR1A = 0;
+	TCCR1B = ( 1 << CS10 );
+#endif
+}
+
+static uint32_t Bench_u32Now(void)
+{
+#if defined( __AVR__ )
+	return TCNT1;
+#elif defined( __x86_64__ ) || defined( __i386__ )
+	return ( uint32_t ) __rdtsc();
+#else
+	struct timespec xNow;
+	clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( uint32_t ) ( ( xNow.tv_sec * 1000000000UL ) + xNow.tv_nsec );
+#endif
+}
+
+/*Timer width, the difference of two readings is taken modulo it*/
+#if defined( __AVR__ )
+	#define BENCH_ELAPSED( ulStart, ulEnd )		( ( uint16_t ) ( ( ulEnd ) - ( ulStart ) ) )
+#else
+	#define BENCH_ELAPSED( ulStart, ulEnd )		( ( uint32_t ) ( ( ulEnd ) - ( ulStart ) ) )
+#endif
+
+/*Average cost of one pair, less the cost of reading the timer*/
+static uint32_t Bench_u32TimePairs(QueueHandle_t Copy_xQueue,uint32_t Copy_u32Overhead)
+{
+	uint32_t Local_u32Total = 0;
+	uint32_t Local_u32Start;
+	uint32_t Local_u32Pair;
+	uint32_t Local_u32Count;
+
+	for(Local_u32Count = 0; Local_u32Count < BENCH_PAIRS; Local_u32Count++)
+	{
+		Local_u32Start = Bench_u32Now();
+		( void ) xQueueSend(Copy_xQueue,Bench_ucItem,0);
+		( void ) xQueueReceive(Copy_xQueue,Bench_ucItem,0);
+		Local_u32Pair = BENCH_ELAPSED(Local_u32Start,Bench_u32Now());
+		Local_u32Total += (Local_u32Pair > Copy_u32Overhead) ? (Local_u32Pair - Copy_u32Overhead) : 0;
+	}
+	return Local_u32Total / BENCH_PAIRS;
+}
+
+static uint32_t Bench_u32TimerOverhead(void)
+{
+	uint32_t Local_u32Start;
+	uint32_t Local_u32Min = 0xFFFFFFFFUL;
+	uint32_t Local_u32Elapsed;
+	uint32_t Local_u32Count;
+
+	for(Local_u32Count = 0; Local_u32Count < BENCH_PAIRS; Local_u32Count++)
+	{
+		Local_u32Start = Bench_u32Now();
+		Local_u32Elapsed = BENCH_ELAPSED(Local_u32Start,Bench_u32Now());
+		if(Local_u32Elapsed < Local_u32Min)
+		{
+			Local_u32Min = Local_u32Elapsed;
+		}
+	}
+	return Local_u32Min;
+}
+
+/*************** Output ***************/
+
+#if defined( __AVR__ )
+static void Bench_vPrintString(const char *Copy_pcString)
+{
+	while('\0' != *Copy_pcString)
+	{
+		UART_voidSendByte((u8)*Copy_pcString++);
+	}
+}
+
+static void Bench_vPrintNumber(uint32_t Copy_u32Value,uint8_t Copy_u8Width)
+{
+	char Local_cDigits[11];
+	uint8_t Local_u8Length = 0;
+
+	do
+	{
+		Local_cDigits[Local_u8Length++] = (char)('0' + (Copy_u32Value % 10));
+		Copy_u32Value /= 10;
+	}while(0 != Copy_u32Value);
+	while(Copy_u8Width-- > Local_u8Length)
+	{
+		UART_voidSendByte(' ');
+	}
+	while(0 != Local_u8Length)
+	{
+		UART_voidSendByte((u8)Local_cDigits[--Local_u8Length]);
+	}
+}
+#endif
+
+#if ( configUSE_QUEUE_COPY_ROUTINES == 1 )
+	#define BENCH_COPY_NAME		"copy routines"
+#else
+	#define BENCH_COPY_NAME		"memcpy"
+#endif
+
+static void Bench_vPrintHeader(void)
+{
+#if defined( __AVR__ )
+	Bench_vPrintString("size  " BENCH_COPY_NAME " (cycles per send/receive pair)\r\n");
+#else
+	printf("size  " BENCH_COPY_NAME " (%s per send/receive pair)\n",
+	#if defined( __x86_64__ ) || defined( __i386__ )
+		"TSC ticks"
+	#else
+		"ns"
+	#endif
+		);
+#endif
+}
+
+static void Bench_vPrintLine(UBaseType_t Copy_uxSize,uint32_t Copy_u32Pair)
+{
+#if defined( __AVR__ )
+	Bench_vPrintNumber(Copy_uxSize,4);
+	Bench_vPrintNumber(Copy_u32Pair,8);
+	Bench_vPrintString("\r\n");
+#else
+	printf("%4u %7lu\n",(unsigned)Copy_uxSize,(unsigned long)Copy_u32Pair);
+#endif
+}
+
+int main(void)
+{
+	QueueHandle_t Local_xQueue;
+	uint32_t Local_u32Overhead;
+	uint8_t Local_u8Index;
+
+#if defined( __AVR__ )
+	UART_voidInit();
+#endif
+	Bench_vTimerInit();
+	Local_u32Overhead = Bench_u32TimerOverhead();
+	Bench_vPrintHeader();
+
+	for(Local_u8Index = 0; Local_u8Index < (sizeof(Bench_uxSizes) / sizeof(Bench_uxSizes[0])); Local_u8Index++)
+	{
+		Local_xQueue = xQueueCreateStatic(1,Bench_uxSizes[Local_u8Index],Bench_ucQueueStorage,&Bench_xQueueBuffer);
+		Bench_vPrintLine(Bench_uxSizes[Local_u8Index],Bench_u32TimePairs(Local_xQueue,Local_u32Overhead));
+	}
+
+#if defined( __AVR__ )
+	for(;;);
+#else
+	return 0;
+#endif
+}
+
+/*************** The kernel functions queue.c calls ***************/
+/*
+With no scheduler running, no block time and nothing waiting on the queue,
+none of these are reached by the pairs timed, they only let queue.c link.
+*/
+
+BaseType_t xTaskRemoveFromEventList(const List_t * const pxEventList) { ( void ) pxEventList; return pdFALSE; }
+void vTaskPlaceOnEventList(List_t * const pxEventList,const TickType_t xTicksToWait) { ( void ) pxEventList; ( void ) xTicksToWait; }
+void vTaskPlaceOnEventListRestricted(List_t * const pxEventList,TickType_t xTicksToWait,const BaseType_t xWaitIndefinitely) { ( void ) pxEventList; ( void ) xTicksToWait; ( void ) xWaitIndefinitely; }
+void vTaskSuspendAll(void) {}
+BaseType_t xTaskResumeAll(void) { return pdFALSE; }
+void vTaskMissedYield(void) {}
+void vTaskSetTimeOutState(TimeOut_t * const pxTimeOut) { ( void ) pxTimeOut; }
+BaseType_t xTaskCheckForTimeOut(TimeOut_t * const pxTimeOut,TickType_t * const pxTicksToWait) { ( void ) pxTimeOut; ( void ) pxTicksToWait; return pdTRUE; }
+void vTaskPriorityInherit(TaskHandle_t const pxMutexHolder) { ( void ) pxMutexHolder; }
+BaseType_t xTaskPriorityDisinherit(TaskHandle_t const pxMutexHolder) { ( void ) pxMutexHolder; return pdFALSE; }
+void *pvTaskIncrementMutexHeldCount(void) { return NULL; }
+TaskHandle_t xTaskGetCurrentTaskHandle(void) { return NULL; }
+BaseType_t xTaskGetSchedulerState(void) { return taskSCHEDULER_NOT_STARTED; }
+void vCoRoutineAddToDelayedList(TickType_t xTicksToDelay,List_t *pxEventList) { ( void ) xTicksToDelay; ( void ) pxEventList; }
+BaseType_t xCoRoutineRemoveFromEventList(const List_t *pxEventList) { ( void ) pxEventList; return pdFALSE; }
+void vPortYield(void) {}
@@ -0,0 +1,499 @@
+/***************************************************************************************/
+/***************************************************************************************/
+/**************************** Author : Mohammed Elsayaad *******************************/
+/**************************** Date : 17 Oct,2026         *******************************/
+/**************************** Description: Host decoder for the binary scheduler *******/
+/****************************              trace sent by Serivce/Trace        *********/
+/***************************************************************************************/
+/***************************************************************************************/
+/*
+Build and use on Linux:
+	gcc -O2 -o trace_decode trace_decode.c
+	stty -F /dev/ttyUSB0 57600 raw -echo
+	cat /dev/ttyUSB0 > trace.bin			(stop with Ctrl+C)
+	./trace_decode -t 1=LCD -t 2=KEYPAD -t 3=IDLE -t "4=Tmr Svc" trace.bin
+
+Options:
+	-v				print every event, the per task timeline
+	-t N=name		name task number N (tasks are numbered in creation order)
+	-q N=name		name queue number N (queues and semaphores, creation order)
+	-c us			run time stats clock period in microseconds, default 4
+	-k us			tick period in microseconds, default 1000
+With no file the trace is read from standard input.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../../Serivce/Trace/Trace_events.h"
+
+#define DECODE_OBJECTS		(TRACE_OBJECT_MASK + 1)
+#define DECODE_NAME_LENGTH	16
+#define DECODE_NO_TASK		(-1)
+
+typedef struct
+{
+	char name[DECODE_NAME_LENGTH];
+	int seen;
+	int priority;
+	uint64_t runTime;
+	uint32_t switchIns;
+	/*Queue the task blocked on, its direction and when, for the latency*/
+	int blockedQueue;
+	int blockedOnSend;
+	uint64_t blockedAt;
+}decodeTask_t;
+
+typedef struct
+{
+	uint32_t count;
+	uint64_t total;
+	uint64_t min;
+	uint64_t max;
+}decodeLatency_t;
+
+typedef struct
+{
+	char name[DECODE_NAME_LENGTH];
+	int seen;
+	int length;
+	int waiting;
+	int maxWaiting;
+	uint64_t lastChange;
+	uint64_t waitingIntegral;
+	uint32_t sends;
+	uint32_t receives;
+	uint32_t sendFails;
+	uint32_t receiveFails;
+	/*Indexed [task][0 receive, 1 send]*/
+	decodeLatency_t blocked[DECODE_OBJECTS][2];
+}decodeQueue_t;
+
+static decodeTask_t Decode_axTasks[DECODE_OBJECTS];
+static decodeQueue_t Decode_axQueues[DECODE_OBJECTS];
+static int Decode_intCurrentTask = DECODE_NO_TASK;
+static uint64_t Decode_u64SwitchedInAt;
+static uint64_t Decode_u64Now;
+static int Decode_intStarted;
+static uint16_t Decode_u16LastStamp;
+static uint32_t Decode_u32Records;
+static uint32_t Decode_u32Lost;
+static double Decode_f64ClockUs = 4.0;
+static double Decode_f64TickUs = 1000.0;
+static int Decode_intVerbose;
+
+static double Decode_f64Us(uint64_t Copy_u64Counts)
+{
+	return (double)Copy_u64Counts * Decode_f64ClockUs;
+}
+
+static const char *Decode_pcTaskName(int Copy_intTask)
+{
+	static char Local_acName[DECODE_NAME_LENGTH];
+
+	if(Decode_axTasks[Copy_intTask].name[0] != '\0')
+	{
+		return Decode_axTasks[Copy_intTask].name;
+	}
+	snprintf(Local_acName,sizeof(Local_acName),"task%d",Copy_intTask);
+	return Local_acName;
+}
+
+static const char *Decode_pcQueueName(int Copy_intQueue)
+{
+	static char Local_acName[DECODE_NAME_LENGTH];
+
+	if(Decode_axQueues[Copy_intQueue].name[0] != '\0')
+	{
+		return Decode_axQueues[Copy_intQueue].name;
+	}
+	snprintf(Local_acName,sizeof(Local_acName),"queue%d",Copy_intQueue);
+	return Local_acName;
+}
+
+/*Time stamps are 16 bits so wrap every 65536 counts.  The recorder makes sure
+  records are never further apart than that, except across tickless idle where
+  the tick step record says how long the sleep was*/
+static void Decode_voidAdvanceTime(uint16_t Copy_u16Stamp,int Copy_intEvent,unsigned Copy_u32Ticks)
+{
+	uint64_t Local_u64Delta;
+	double Local_f64MinimumUs;
+
+	if(0 == Decode_intStarted)
+	{
+		Decode_intStarted = 1;
+		Decode_u16LastStamp = Copy_u16Stamp;
+		Decode_u64Now = 0;
+		return;
+	}
+	Local_u64Delta = (uint16_t)(Copy_u16Stamp - Decode_u16LastStamp);
+	if((TRACE_EVT_TICK_STEP == Copy_intEvent) && (Copy_u32Ticks > 1))
+	{
+		Local_f64MinimumUs = (double)(Copy_u32Ticks - 1) * Decode_f64TickUs;
+		while(Decode_f64Us(Local_u64Delta) < Local_f64MinimumUs)
+		{
+			Local_u64Delta += 65536;
+		}
+	}
+	Decode_u64Now += Local_u64Delta;
+	Decode_u16LastStamp = Copy_u16Stamp;
+}
+
+static void Decode_voidQueueLevel(int Copy_intQueue,int Copy_intWaiting)
+{
+	decodeQueue_t *Local_pxQueue = &Decode_axQueues[Copy_intQueue];
+
+	if(Copy_intWaiting < 0)
+	{
+		Copy_intWaiting = 0;
+	}
+	if((Local_pxQueue->length > 0) && (Copy_intWaiting > Local_pxQueue->length))
+	{
+		/*Overwrite of a full queue*/
+		Copy_intWaiting = Local_pxQueue->length;
+	}
+	Local_pxQueue->waitingIntegral += (uint64_t)Local_pxQueue->waiting * (Decode_u64Now - Local_pxQueue->lastChange);
+	Local_pxQueue->lastChange = Decode_u64Now;
+	Local_pxQueue->waiting = Copy_intWaiting;
+	if(Copy_intWaiting > Local_pxQueue->maxWaiting)
+	{
+		Local_pxQueue->maxWaiting = Copy_intWaiting;
+	}
+}
+
+static void Decode_voidSwitchIn(int Copy_intTask,int Copy_intPriority)
+{
+	decodeTask_t *Local_pxTask = &Decode_axTasks[Copy_intTask];
+	decodeLatency_t *Local_pxLatency;
+	uint64_t Local_u64Latency;
+
+	if(DECODE_NO_TASK != Decode_intCurrentTask)
+	{
+		Decode_axTasks[Decode_intCurrentTask].runTime += Decode_u64Now - Decode_u64SwitchedInAt;
+	}
+	if(Local_pxTask->blockedQueue >= 0)
+	{
+		Local_u64Latency = Decode_u64Now - Local_pxTask->blockedAt;
+		Local_pxLatency = &Decode_axQueues[Local_pxTask->blockedQueue].blocked[Copy_intTask][Local_pxTask->blockedOnSend];
+		if((0 == Local_pxLatency->count) || (Local_u64Latency < Local_pxLatency->min))
+		{
+			Local_pxLatency->min = Local_u64Latency;
+		}
+		if(Local_u64Latency > Local_pxLatency->max)
+		{
+			Local_pxLatency->max = Local_u64Latency;
+		}
+		Local_pxLatency->total += Local_u64Latency;
+		Local_pxLatency->count++;
+		Local_pxTask->blockedQueue = -1;
+	}
+	Local_pxTask->seen = 1;
+	Local_pxTask->priority = Copy_intPriority;
+	Local_pxTask->switchIns++;
+	Decode_intCurrentTask = Copy_intTask;
+	Decode_u64SwitchedInAt = Decode_u64Now;
+}
+
+static void Decode_voidBlock(int Copy_intQueue,int Copy_intOnSend)
+{
+	decodeTask_t *Local_pxTask;
+
+	if(DECODE_NO_TASK == Decode_intCurrentTask)
+	{
+		return;
+	}
+	Local_pxTask = &Decode_axTasks[Decode_intCurrentTask];
+	Local_pxTask->blockedQueue = Copy_intQueue;
+	Local_pxTask->blockedOnSend = Copy_intOnSend;
+	Local_pxTask->blockedAt = Decode_u64Now;
+}
+
+static void Decode_voidRecord(const uint8_t *Copy_pu8Record)
+{
+	int Local_intEvent = Copy_pu8Record[0] >> 4;
+	int Local_intObject = Copy_pu8Record[0] & TRACE_OBJECT_MASK;
+	int Local_intArgument = Copy_pu8Record[1];
+	uint16_t Local_u16Stamp = (uint16_t)(Copy_pu8Record[2] | (Copy_pu8Record[3] << 8));
+	unsigned Local_u32Ticks = ((unsigned)Local_intObject << 8) | (unsigned)Local_intArgument;
+	decodeQueue_t *Local_pxQueue = &Decode_axQueues[Local_intObject];
+
+	Decode_u32Records++;
+	Decode_voidAdvanceTime(Local_u16Stamp,Local_intEvent,Local_u32Ticks);
+	if(0 != Decode_intVerbose)
+	{
+		printf("%12.0f us  ",Decode_f64Us(Decode_u64Now));
+	}
+
+	switch(Local_intEvent)
+	{
+	case TRACE_EVT_TASK_SWITCHED_IN:
+		Decode_voidSwitchIn(Local_intObject,Local_intArgument);
+		if(0 != Decode_intVerbose) printf("run      %s\n",Decode_pcTaskName(Local_intObject));
+		break;
+	case TRACE_EVT_TASK_CREATE:
+		Decode_axTasks[Local_intObject].seen = 1;
+		Decode_axTasks[Local_intObject].priority = Local_intArgument;
+		if(0 != Decode_intVerbose) printf("create   %s priority %d\n",Decode_pcTaskName(Local_intObject),Local_intArgument);
+		break;
+	case TRACE_EVT_TASK_READY:
+		if(0 != Decode_intVerbose) printf("ready    %s\n",Decode_pcTaskName(Local_intObject));
+		break;
+	case TRACE_EVT_TASK_DELAY:
+		if(0 != Decode_intVerbose) printf("delay    %s\n",Decode_pcTaskName(Local_intObject));
+		break;
+	case TRACE_EVT_TICK:
+		if(0 != Decode_intVerbose) printf("tick     %u\n",(((unsigned)Local_intObject << 14) | ((unsigned)Local_intArgument << TRACE_TICK_MARKER_SHIFT)) & 0xFFFFu);
+		break;
+	case TRACE_EVT_TICK_STEP:
+		if(0 != Decode_intVerbose) printf("sleep    %u ticks\n",Local_u32Ticks);
+		break;
+	case TRACE_EVT_QUEUE_CREATE:
+		Local_pxQueue->seen = 1;
+		Local_pxQueue->length = Local_intArgument;
+		Local_pxQueue->waiting = 0;
+		Local_pxQueue->lastChange = Decode_u64Now;
+		if(0 != Decode_intVerbose) printf("create   %s length %d\n",Decode_pcQueueName(Local_intObject),Local_intArgument);
+		break;
+	case TRACE_EVT_QUEUE_SEND:
+	case TRACE_EVT_QUEUE_SEND_FROM_ISR:
+		Local_pxQueue->seen = 1;
+		Local_pxQueue->sends++;
+		Decode_voidQueueLevel(Local_intObject,Local_intArgument + 1);
+		if(0 != Decode_intVerbose) printf("send     %s -> %d waiting%s\n",Decode_pcQueueName(Local_intObject),Local_pxQueue->waiting,(TRACE_EVT_QUEUE_SEND_FROM_ISR == Local_intEvent) ? " (ISR)" : "");
+		break;
+	case TRACE_EVT_QUEUE_RECEIVE:
+	case TRACE_EVT_QUEUE_RECEIVE_FROM_ISR:
+		Local_pxQueue->seen = 1;
+		Local_pxQueue->receives++;
+		Decode_voidQueueLevel(Local_intObject,Local_intArgument - 1);
+		if(0 != Decode_intVerbose) printf("receive  %s -> %d waiting%s\n",Decode_pcQueueName(Local_intObject),Local_pxQueue->waiting,(TRACE_EVT_QUEUE_RECEIVE_FROM_ISR == Local_intEvent) ? " (ISR)" : "");
+		break;
+	case TRACE_EVT_QUEUE_SEND_FAILED:
+		Local_pxQueue->seen = 1;
+		Local_pxQueue->sendFails++;
+		if(0 != Decode_intVerbose) printf("send     %s failed, %d waiting\n",Decode_pcQueueName(Local_intObject),Local_intArgument);
+		break;
+	case TRACE_EVT_QUEUE_RECEIVE_FAILED:
+		Local_pxQueue->seen = 1;
+		Local_pxQueue->receiveFails++;
+		if(0 != Decode_intVerbose) printf("receive  %s failed, %d waiting\n",Decode_pcQueueName(Local_intObject),Local_intArgument);
+		break;
+	case TRACE_EVT_QUEUE_BLOCK_SEND:
+	case TRACE_EVT_QUEUE_BLOCK_RECEIVE:
+		Local_pxQueue->seen = 1;
+		Decode_voidBlock(Local_intObject,TRACE_EVT_QUEUE_BLOCK_SEND == Local_intEvent);
+		if(0 != Decode_intVerbose) printf("block    %s on %s %s\n",(DECODE_NO_TASK == Decode_intCurrentTask) ? "?" : Decode_pcTaskName(Decode_intCurrentTask),(TRACE_EVT_QUEUE_BLOCK_SEND == Local_intEvent) ? "send to" : "receive from",Decode_pcQueueName(Local_intObject));
+		break;
+	default:
+		if(0 != Decode_intVerbose) printf("unknown  event %d object %d argument %d\n",Local_intEvent,Local_intObject,Local_intArgument);
+		break;
+	}
+}
+
+/*Records were lost, so which task ran and who was blocked is unknown until
+  the next switch in*/
+static void Decode_voidLost(unsigned Copy_u32Lost)
+{
+	int Local_intTask;
+
+	Decode_u32Lost += Copy_u32Lost;
+	if(0 != Decode_intVerbose)
+	{
+		printf("%12s     lost     %u records\n","",Copy_u32Lost);
+	}
+	if(DECODE_NO_TASK != Decode_intCurrentTask)
+	{
+		Decode_axTasks[Decode_intCurrentTask].runTime += Decode_u64Now - Decode_u64SwitchedInAt;
+	}
+	Decode_intCurrentTask = DECODE_NO_TASK;
+	for(Local_intTask = 0;Local_intTask < DECODE_OBJECTS;Local_intTask++)
+	{
+		Decode_axTasks[Local_intTask].blockedQueue = -1;
+	}
+}
+
+static void Decode_voidReport(void)
+{
+	uint64_t Local_u64Span;
+	int Local_intIndex;
+	int Local_intTask;
+	int Local_intDirection;
+	decodeQueue_t *Local_pxQueue;
+	decodeLatency_t *Local_pxLatency;
+
+	if(DECODE_NO_TASK != Decode_intCurrentTask)
+	{
+		Decode_axTasks[Decode_intCurrentTask].runTime += Decode_u64Now - Decode_u64SwitchedInAt;
+		Decode_u64SwitchedInAt = Decode_u64Now;
+	}
+	Local_u64Span = Decode_u64Now;
+	printf("\n%u records, %u lost, %.3f s traced\n",Decode_u32Records,Decode_u32Lost,Decode_f64Us(Local_u64Span) / 1000000.0);
+
+	printf("\n%-16s %8s %10s %12s %7s %12s\n","task","priority","switch ins","run time us","cpu %","avg run us");
+	for(Local_intIndex = 0;Local_intIndex < DECODE_OBJECTS;Local_intIndex++)
+	{
+		decodeTask_t *Local_pxTask = &Decode_axTasks[Local_intIndex];
+		if(0 == Local_pxTask->seen)
+		{
+			continue;
+		}
+		printf("%-16s %8d %10u %12.0f %7.2f %12.1f\n",Decode_pcTaskName(Local_intIndex),Local_pxTask->priority,Local_pxTask->switchIns,
+			Decode_f64Us(Local_pxTask->runTime),
+			(Local_u64Span > 0) ? (100.0 * (double)Local_pxTask->runTime / (double)Local_u64Span) : 0.0,
+			(Local_pxTask->switchIns > 0) ? (Decode_f64Us(Local_pxTask->runTime) / Local_pxTask->switchIns) : 0.0);
+	}
+
+	printf("\n%-16s %6s %6s %6s %6s %6s %8s %8s\n","queue","length","sends","recvs","s fail","r fail","max wait","avg wait");
+	for(Local_intIndex = 0;Local_intIndex < DECODE_OBJECTS;Local_intIndex++)
+	{
+		Local_pxQueue = &Decode_axQueues[Local_intIndex];
+		if(0 == Local_pxQueue->seen)
+		{
+			continue;
+		}
+		Decode_voidQueueLevel(Local_intIndex,Local_pxQueue->waiting);
+		printf("%-16s %6d %6u %6u %6u %6u %8d %8.3f\n",Decode_pcQueueName(Local_intIndex),Local_pxQueue->length,Local_pxQueue->sends,Local_pxQueue->receives,
+			Local_pxQueue->sendFails,Local_pxQueue->receiveFails,Local_pxQueue->maxWaiting,
+			(Local_u64Span > 0) ? ((double)Local_pxQueue->waitingIntegral / (double)Local_u64Span) : 0.0);
+	}
+
+	printf("\nblocking latency, from blocking on the queue to running again\n");
+	printf("%-16s %-16s %-7s %6s %10s %10s %10s\n","task","queue","on","times","min us","avg us","max us");
+	for(Local_intIndex = 0;Local_intIndex < DECODE_OBJECTS;Local_intIndex++)
+	{
+		for(Local_intTask = 0;Local_intTask < DECODE_OBJECTS;Local_intTask++)
+		{
+			for(Local_intDirection = 0;Local_intDirection < 2;Local_intDirection++)
+			{
+				Local_pxLatency = &Decode_axQueues[Local_intIndex].blocked[Local_intTask][Local_intDirection];
+				if(0 == Local_pxLatency->count)
+				{
+					continue;
+				}
+				printf("%-16s ",Decode_pcTaskName(Local_intTask));
+				printf("%-16s %-7s %6u %10.0f %10.0f %10.0f\n",Decode_pcQueueName(Local_intIndex),(0 != Local_intDirection) ? "send" : "receive",
+					Local_pxLatency->count,Decode_f64Us(Local_pxLatency->min),
+					Decode_f64Us(Local_pxLatency->total) / Local_pxLatency->count,Decode_f64Us(Local_pxLatency->max));
+			}
+		}
+	}
+}
+
+static int Decode_intSetName(char *Copy_pcArgument,int Copy_intIsQueue)
+{
+	char *Local_pcName = strchr(Copy_pcArgument,'=');
+	int Local_intNumber;
+
+	if(NULL == Local_pcName)
+	{
+		return -1;
+	}
+	Local_intNumber = atoi(Copy_pcArgument);
+	if((Local_intNumber < 0) || (Local_intNumber >= DECODE_OBJECTS))
+	{
+		return -1;
+	}
+	Local_pcName++;
+	if(0 != Copy_intIsQueue)
+	{
+		snprintf(Decode_axQueues[Local_intNumber].name,DECODE_NAME_LENGTH,"%s",Local_pcName);
+	}
+	else
+	{
+		snprintf(Decode_axTasks[Local_intNumber].name,DECODE_NAME_LENGTH,"%s",Local_pcName);
+	}
+	return 0;
+}
+
+int main(int argc,char **argv)
+{
+	FILE *Local_pxInput = stdin;
+	uint8_t Local_au8Record[TRACE_RECORD_SIZE];
+	int Local_intArgument;
+	int Local_intByte;
+	int Local_intCount;
+	int Local_intLost;
+	int Local_intIndex;
+
+	for(Local_intIndex = 0;Local_intIndex < DECODE_OBJECTS;Local_intIndex++)
+	{
+		Decode_axTasks[Local_intIndex].blockedQueue = -1;
+	}
+	for(Local_intArgument = 1;Local_intArgument < argc;Local_intArgument++)
+	{
+		char *Local_pcOption = argv[Local_intArgument];
+		if(0 == strcmp(Local_pcOption,"-v"))
+		{
+			Decode_intVerbose = 1;
+		}
+		else if((Local_intArgument + 1 < argc) && (0 == strcmp(Local_pcOption,"-t")))
+		{
+			if(0 != Decode_intSetName(argv[++Local_intArgument],0)) goto usage;
+		}
+		else if((Local_intArgument + 1 < argc) && (0 == strcmp(Local_pcOption,"-q")))
+		{
+			if(0 != Decode_intSetName(argv[++Local_intArgument],1)) goto usage;
+		}
+		else if((Local_intArgument + 1 < argc) && (0 == strcmp(Local_pcOption,"-c")))
+		{
+			Decode_f64ClockUs = atof(argv[++Local_intArgument]);
+		}
+		else if((Local_intArgument + 1 < argc) && (0 == strcmp(Local_pcOption,"-k")))
+		{
+			Decode_f64TickUs = atof(argv[++Local_intArgument]);
+		}
+		else if(('-' != Local_pcOption[0]) && (stdin == Local_pxInput))
+		{
+			Local_pxInput = fopen(Local_pcOption,"rb");
+			if(NULL == Local_pxInput)
+			{
+				perror(Local_pcOption);
+				return 1;
+			}
+		}
+		else
+		{
+			goto usage;
+		}
+	}
+	if((Decode_f64ClockUs <= 0.0) || (Decode_f64TickUs <= 0.0))
+	{
+		goto usage;
+	}
+
+	/*Frames: sync, record count, lost count, records.  Anything else is
+	  skipped, which also finds the first frame of a capture started mid way*/
+	while(EOF != (Local_intByte = fgetc(Local_pxInput)))
+	{
+		if(TRACE_FRAME_SYNC != Local_intByte)
+		{
+			continue;
+		}
+		Local_intCount = fgetc(Local_pxInput);
+		Local_intLost = fgetc(Local_pxInput);
+		if((EOF == Local_intCount) || (EOF == Local_intLost))
+		{
+			break;
+		}
+		if(Local_intLost > 0)
+		{
+			Decode_voidLost((unsigned)Local_intLost);
+		}
+		for(;Local_intCount > 0;Local_intCount--)
+		{
+			if(TRACE_RECORD_SIZE != fread(Local_au8Record,1,TRACE_RECORD_SIZE,Local_pxInput))
+			{
+				break;
+			}
+			Decode_voidRecord(Local_au8Record);
+		}
+	}
+	Decode_voidReport();
+	return 0;
+
+usage:
+	fprintf(stderr,"usage: %s [-v] [-t N=name]... [-q N=name]... [-c clock us] [-k tick us] [trace file]\n",argv[0]);
+	return 2;
+}
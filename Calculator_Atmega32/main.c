@@ -6,20 +6,22 @@ The calculator project is a real-time application that uses a microcontroller (A
 a keypad and an LCD to perform arithmetic operations.
 The project uses FreeRTOS, a real-time operating system (RTOS) that manages the scheduling and
  synchronization of the tasks and queues.
-The project has four tasks and four queues as follows:
+The project has three tasks, two co-routines, five queues and a queue set as follows:
 
-KEYPAD_Task: This task reads the input from the keypad and sends it to a queue. It also debounces the keypad to avoid false readings.
+KEYPAD_Task: This task reads the input from the keypad and sends it to a queue. The keypad is scanned from the tick
+interrupt every 5 ms, each key is debounced there and its events are queued to this task, which blocks on that queue.
 The input can be digits, operators, or special keys such as equal.
 
 LCD_Task   : This task displays the input and output of the calculator on the LCD.
-It receives the display structure from a queue and updates the LCD accordingly.
+It blocks on a queue set holding all its inputs, receives the display structure from the queue that
+became ready and updates the LCD accordingly.
 The display structure contains the operands, the operator, the result, and the error flag of the calculator.
 
-CALC_Task  : This task performs the arithmetic operation based on the input from the keypad and the switch.
+CALC_CoRoutine  : This co-routine performs the arithmetic operation based on the input from the keypad and the switch.
 It receives the input from two queues and sends the output to two queues.
 It also handles any errors such as division by zero.
 
-Timing_Task: This task handle the timing of the system as LCD should always display time during working as
+Timing_CoRoutine: This co-routine handle the timing of the system as LCD should always display time during working as
 follows (h:mm:ss).
 
 The project demonstrates how RTOS can be used to create a responsive and reliable calculator application
@@ -39,8 +41,10 @@ using multiple tasks and queues.
 #include "FreeRTOS.h"
 #include "projdefs.h"
 #include "task.h"
+#include "croutine.h"
 #include "semphr.h"
 #include "queue.h"
+#include "timers.h"
 
 /************* HAL layer inclusions *******************/
 
@@ -58,13 +62,64 @@ static QueueHandle_t	Key2Calc_Queue;
 static QueueHandle_t	Key2LCD_Queue;
 static QueueHandle_t	Time2LCD_Queue;
 static QueueHandle_t	Calc2LCD_Queue;
+static QueueHandle_t	KeyEvent_Queue;
 
 /*********Create All Needed Semaphores Handles************/
 
 static SemaphoreHandle_t KeyPad2LCD_ClearNotification;
-static SemaphoreHandle_t KeyPad2Timer_StartCounting;
-static SemaphoreHandle_t KeyPad2Timer_StopCounting;
-static SemaphoreHandle_t Timer2KeyPad_TenSecondsNotification;
+
+/*********Everything the LCD task waits on************/
+
+static QueueSetHandle_t	LCD_QueueSet;
+
+/*********Inactivity Timer and the task it notifies************/
+
+static TimerHandle_t	Inactivity_Timer;
+static TaskHandle_t		KeyPad_TaskHandle;
+static TaskHandle_t		LCD_TaskHandle;
+
+/*********Keys lost as the keypad task fell behind (key event queue full)************/
+
+static volatile uint16_t KeyPad_u16Overflows = 0;
+
+/*********Tick of the last keypad scan, written from the tick hook************/
+
+static volatile TickType_t KeyPad_xLastScanTick = 0;
+
+#if configSUPPORT_STATIC_ALLOCATION == 1
+/*********Static Memory of Tasks, Queues and Semaphores************/
+
+static StaticTask_t		LCD_TaskBuffer;
+static StaticTask_t		KeyPad_TaskBuffer;
+static StaticTask_t		Idle_TaskBuffer;
+static StaticTask_t		TimerSvc_TaskBuffer;
+static StackType_t		LCD_TaskStack[LCD_Task_STACK_SIZE];
+static StackType_t		KeyPad_TaskStack[KEYPAD_Task_STACK_SIZE];
+static StackType_t		Idle_TaskStack[configMINIMAL_STACK_SIZE];
+static StackType_t		TimerSvc_TaskStack[configTIMER_TASK_STACK_DEPTH];
+
+/*Co-routines share the idle task stack, the control block is all they need*/
+static CRCB_t			Calc_CoRoutineBuffer;
+static CRCB_t			Timer_CoRoutineBuffer;
+
+static StaticQueue_t	Key2Calc_QueueBuffer;
+static StaticQueue_t	Key2LCD_QueueBuffer;
+static StaticQueue_t	Time2LCD_QueueBuffer;
+static StaticQueue_t	Calc2LCD_QueueBuffer;
+static StaticQueue_t	KeyEvent_QueueBuffer;
+static uint8_t			Key2Calc_QueueStorage[KEY2CALC_QUEUE_LENGTH * KEY2CALC_QUEUE_WIDTH];
+static uint8_t			Key2LCD_QueueStorage[KEY2LCD_QUEUE_LENGTH * KEY2LCD_QUEUE_WIDTH];
+static uint8_t			Time2LCD_QueueStorage[TIM2LCD_QUEUE_LENGTH * TIM2LCD_QUEUE_WIDTH];
+static uint8_t			Calc2LCD_QueueStorage[CALC2LCD_QUEUE_LENGTH * CALC2LCD_QUEUE_WIDTH];
+static uint8_t			KeyEvent_QueueStorage[KEYEVENT_QUEUE_LENGTH * KEYEVENT_QUEUE_WIDTH];
+
+static StaticSemaphore_t KeyPad2LCD_ClearNotificationBuffer;
+
+static StaticQueue_t	LCD_QueueSetBuffer;
+static uint8_t			LCD_QueueSetStorage[LCD_QUEUESET_LENGTH * sizeof(QueueSetMemberHandle_t)];
+
+static StaticTimer_t	Inactivity_TimerBuffer;
+#endif
 
 /****************************** Global Variables Defination end  ***********************************/
 
@@ -74,23 +129,66 @@ int main(void)
 	/*Initialization of Keypad and LCD*/
     HAL_LCD_voidInit();
 	HAL_Keypad_voidInit();
+	/*The LCD task is told when the engine has sent everything*/
+	HAL_LCD_voidSetCallBack(&LCD_vTransferDone);
+	/*Keys are scanned from the tick hook and queued to the keypad task*/
+	HAL_Keypad_voidSetCallBack(&Keypad_vKeyEvent);
+#if configUSE_TRACE_RECORDER == 1
+	/*UART used to send the scheduler trace*/
+	TRACE_voidInit();
+#endif
+#if configSUPPORT_STATIC_ALLOCATION == 1
 	/*Create Tasks*/
-	xTaskCreate(&LCD_vTask,NULL,LCD_Task_STACK_SIZE,NULL,LCD_Task_PRIORITY,NULL);
-	xTaskCreate(&Calc_vTask,NULL,CALC_Task_STACK_SIZE,NULL,CALC_Task_PRIORITY,NULL);
-	xTaskCreate(&KeyPad_vTask,NULL,KEYPAD_Task_STACK_SIZE,NULL,KEYPAD_Task_PRIORITY,NULL);
-	xTaskCreate(&Timer_vTask,NULL,TIMING_Task_STACK_SIZE,NULL,TIMING_Task_PRIORITY,NULL);
+	LCD_TaskHandle = xTaskCreateStatic(&LCD_vTask,"LCD",LCD_Task_STACK_SIZE,NULL,LCD_Task_PRIORITY,LCD_TaskStack,&LCD_TaskBuffer);
+	KeyPad_TaskHandle = xTaskCreateStatic(&KeyPad_vTask,"KEYPAD",KEYPAD_Task_STACK_SIZE,NULL,KEYPAD_Task_PRIORITY,KeyPad_TaskStack,&KeyPad_TaskBuffer);
+	/*Create Co-routines (run from the idle task hook)*/
+	xCoRoutineCreateStatic(&Calc_vCoRoutine,CALC_CoRoutine_PRIORITY,0,&Calc_CoRoutineBuffer);
+	xCoRoutineCreateStatic(&Timer_vCoRoutine,TIMING_CoRoutine_PRIORITY,0,&Timer_CoRoutineBuffer);
+	/*Queue Creation*/
+	
+	Key2Calc_Queue = xQueueCreateStatic(KEY2CALC_QUEUE_LENGTH, KEY2CALC_QUEUE_WIDTH, Key2Calc_QueueStorage, &Key2Calc_QueueBuffer);
+	Key2LCD_Queue  = xQueueCreateStatic(KEY2LCD_QUEUE_LENGTH, KEY2LCD_QUEUE_WIDTH, Key2LCD_QueueStorage, &Key2LCD_QueueBuffer);
+	Calc2LCD_Queue = xQueueCreateStatic(CALC2LCD_QUEUE_LENGTH, CALC2LCD_QUEUE_WIDTH, Calc2LCD_QueueStorage, &Calc2LCD_QueueBuffer);
+	Time2LCD_Queue = xQueueCreateStatic(TIM2LCD_QUEUE_LENGTH, TIM2LCD_QUEUE_WIDTH, Time2LCD_QueueStorage, &Time2LCD_QueueBuffer);
+	KeyEvent_Queue = xQueueCreateStatic(KEYEVENT_QUEUE_LENGTH, KEYEVENT_QUEUE_WIDTH, KeyEvent_QueueStorage, &KeyEvent_QueueBuffer);
+	/*Semaphore Creation*/
+	
+	KeyPad2LCD_ClearNotification        = xSemaphoreCreateBinaryStatic(&KeyPad2LCD_ClearNotificationBuffer);
+	/*Queue Set Creation*/
+	
+	LCD_QueueSet = xQueueCreateSetStatic(LCD_QUEUESET_LENGTH, LCD_QueueSetStorage, &LCD_QueueSetBuffer);
+	/*Timer Creation (one shot, restarted by every key)*/
+	
+	Inactivity_Timer = xTimerCreateStatic("IDLE",INACTIVITY_TIMEOUT_PERIOD,pdFALSE,NULL,&Inactivity_vCallback,&Inactivity_TimerBuffer);
+#else
+	/*Create Tasks*/
+	xTaskCreate(&LCD_vTask,NULL,LCD_Task_STACK_SIZE,NULL,LCD_Task_PRIORITY,&LCD_TaskHandle);
+	xTaskCreate(&KeyPad_vTask,NULL,KEYPAD_Task_STACK_SIZE,NULL,KEYPAD_Task_PRIORITY,&KeyPad_TaskHandle);
+	/*Create Co-routines (run from the idle task hook)*/
+	xCoRoutineCreate(&Calc_vCoRoutine,CALC_CoRoutine_PRIORITY,0);
+	xCoRoutineCreate(&Timer_vCoRoutine,TIMING_CoRoutine_PRIORITY,0);
 	/*Queue Creation*/
 	
 	Key2Calc_Queue = xQueueCreate(KEY2CALC_QUEUE_LENGTH, KEY2CALC_QUEUE_WIDTH);
 	Key2LCD_Queue  = xQueueCreate(KEY2LCD_QUEUE_LENGTH, KEY2LCD_QUEUE_WIDTH);
 	Calc2LCD_Queue = xQueueCreate(CALC2LCD_QUEUE_LENGTH, CALC2LCD_QUEUE_WIDTH);
 	Time2LCD_Queue = xQueueCreate(TIM2LCD_QUEUE_LENGTH, TIM2LCD_QUEUE_WIDTH);
+	KeyEvent_Queue = xQueueCreate(KEYEVENT_QUEUE_LENGTH, KEYEVENT_QUEUE_WIDTH);
 	/*Semaphore Creation*/
 	
 	KeyPad2LCD_ClearNotification        = xSemaphoreCreateBinary();
-	KeyPad2Timer_StartCounting          = xSemaphoreCreateBinary();
-	Timer2KeyPad_TenSecondsNotification = xSemaphoreCreateBinary();
-	KeyPad2Timer_StopCounting			= xSemaphoreCreateBinary();
+	/*Queue Set Creation*/
+	
+	LCD_QueueSet = xQueueCreateSet(LCD_QUEUESET_LENGTH);
+	/*Timer Creation (one shot, restarted by every key)*/
+	
+	Inactivity_Timer = xTimerCreate("IDLE",INACTIVITY_TIMEOUT_PERIOD,pdFALSE,NULL,&Inactivity_vCallback);
+#endif
+	/*The LCD inputs join the set while they are still empty*/
+	xQueueAddToSet(Time2LCD_Queue, LCD_QueueSet);
+	xQueueAddToSet(KeyPad2LCD_ClearNotification, LCD_QueueSet);
+	xQueueAddToSet(Calc2LCD_Queue, LCD_QueueSet);
+	xQueueAddToSet(Key2LCD_Queue, LCD_QueueSet);
 	/*Start scheduler*/
 	
 	vTaskStartScheduler();
@@ -99,271 +197,395 @@ int main(void)
 
 void KeyPad_vTask(void *Pv)
 {
-	uint8_t Local_u8ErrorState = pdFALSE;
-	uint8_t Local_u8Key = KEYPAD_NO_KEY;
+	UBaseType_t Local_uxEventCount = 0;
+	UBaseType_t Local_uxEventIndex = 0;
+	uint8_t Local_u8KeyCount = 0;
+	Keypad_Event_t Local_axKeyEvents[KEYEVENT_BATCH_LENGTH];
 	keypadBuffer_t Local_xKeyPadBuffer;
-	BaseType_t Local_xObjectState = pdFALSE;
+	uint32_t Local_u32Notification = 0;
+	Check_vResetKeypadInput(&Local_xKeyPadBuffer);
 	while(1)
 	{
-		Local_u8Key = HAL_Keypad_u8GetKey();
-		if(KEYPAD_NO_KEY != Local_u8Key)
+		/*Block until a key comes in, waking every period anyway to check the inactivity timer*/
+		Local_uxEventCount = xQueueReceiveMultiple(KeyEvent_Queue,Local_axKeyEvents,KEYEVENT_BATCH_LENGTH,KEYPAD_TASK_PERIODICITY);
+		/*Take every key typed ahead before going back to sleep, a batch at a time*/
+		Local_u8KeyCount = 0;
+		while(0 != Local_uxEventCount)
 		{
-			Local_u8ErrorState = Check_vKeypadInput(Local_u8Key,&Local_xKeyPadBuffer);
-			if(pdTRUE == Local_u8ErrorState)
-			{
-				/*Clear LCD Now (wrong Equation)*/
-				xSemaphoreGive(KeyPad2LCD_ClearNotification);
-			}
-			else
+			for(Local_uxEventIndex = 0;Local_uxEventIndex < Local_uxEventCount;Local_uxEventIndex++)
 			{
-				if(1 == Local_xKeyPadBuffer.completeFlag)
-				{
-					/*Send equation to calc task*/
-					xQueueSend(Key2Calc_Queue,&(Local_xKeyPadBuffer.MSG),0);
-					Local_xKeyPadBuffer.completeFlag =0;
-					/*Stop counting if it's already posted*/
-					xSemaphoreGive(KeyPad2Timer_StopCounting);
-				}
-				else
-				{
-					/*send to LCD Task*/
-					xQueueSend(Key2LCD_Queue,&(Local_xKeyPadBuffer.MSG),0);
-					/*Stop counting if it's already posted*/
-					xSemaphoreGive(KeyPad2Timer_StopCounting);
-				}
+				/*Only presses are queued, see Keypad_vKeyEvent*/
+				KeyPad_vHandleKey(Local_axKeyEvents[Local_uxEventIndex].Key,&Local_xKeyPadBuffer);
+				Local_u8KeyCount++;
 			}
+			Local_uxEventCount = xQueueReceiveMultiple(KeyEvent_Queue,Local_axKeyEvents,KEYEVENT_BATCH_LENGTH,0);
 		}
-		else
+		if(0 != Local_u8KeyCount)
 		{
-			if(1 == Local_xKeyPadBuffer.updateFlag)
-			{
-				/*means there is equation still in progress
-				* Requirement is to monitor the input of incomplete equations, if
-					10 sec passed and no activity from user is detected then clear the LCD.
-				*/
-				xSemaphoreGive(KeyPad2Timer_StartCounting);
-			}
+			/*Any activity restarts the 10 sec inactivity timeout*/
+			xTimerReset(Inactivity_Timer,0);
 		}
-		/*Check if LCD clear notification was raised*/
-		Local_xObjectState = xSemaphoreTake(Timer2KeyPad_TenSecondsNotification,0);
-		if(pdPASS == Local_xObjectState)
+		else{/*Nothing*/}
+		/*Check if the inactivity timer expired (10 sec without any key)*/
+		Local_u32Notification = ulTaskNotifyTake(pdTRUE,0);
+		if(0 != Local_u32Notification)
 		{
 			/*Clear LCD*/
 			xSemaphoreGive(KeyPad2LCD_ClearNotification);
-			Check_vKeypadInput(0,NULL);/*To reset the values pass null to this function*/
+			Check_vResetKeypadInput(&Local_xKeyPadBuffer);
 		}
 		else{/*Nothing*/}
-		vTaskDelay(KEYPAD_TASK_PERIODICITY);
 	}
 }
-void Calc_vTask(void *Pv)
+/*Co-routine locals don't survive a blocking call, so every variable used across one is static.
+  The queues are polled (zero block time) as a co-routine can't block on a queue a task also uses*/
+void Calc_vCoRoutine(CoRoutineHandle_t Copy_xHandle,UBaseType_t Copy_uxIndex)
 {
-	BaseType_t Local_xObjectState = pdFALSE;
-	equationMSG_t Local_xKeypadMessage;
-	equationResultMSG_t Local_xResultMessage;
+	static BaseType_t Calc_xObjectState = pdFALSE;
+	static equationMSG_t Calc_xKeypadMessage;
+	static equationResultMSG_t Calc_xResultMessage;
+	(void)Copy_uxIndex;
+	crSTART(Copy_xHandle);
 	while(1)
 	{
-		Local_xObjectState = xQueueReceive(Key2Calc_Queue,&Local_xKeypadMessage,0);
-		if(pdPASS == Local_xObjectState)
+		crQUEUE_RECEIVE(Copy_xHandle,Key2Calc_Queue,&Calc_xKeypadMessage,0,&Calc_xObjectState);
+		if(pdPASS == Calc_xObjectState)
 		{
 			/*Process Data*/
-			Local_xResultMessage.equation.firstVal = Local_xKeypadMessage.firstVal;
-			Local_xResultMessage.equation.Operator = Local_xKeypadMessage.Operator;
-			Local_xResultMessage.equation.secondVal = Local_xKeypadMessage.secondVal;
-			switch(Local_xKeypadMessage.Operator)
+			Calc_xResultMessage.equation.firstVal = Calc_xKeypadMessage.firstVal;
+			Calc_xResultMessage.equation.Operator = Calc_xKeypadMessage.Operator;
+			Calc_xResultMessage.equation.secondVal = Calc_xKeypadMessage.secondVal;
+			switch(Calc_xKeypadMessage.Operator)
 			{
 				case '+':
 					/*the - '0' is to convert from char to number*/
-					Local_xResultMessage.resultVal = (Local_xKeypadMessage.firstVal -'0') + (Local_xKeypadMessage.secondVal-'0');
+					Calc_xResultMessage.resultVal = (Calc_xKeypadMessage.firstVal -'0') + (Calc_xKeypadMessage.secondVal-'0');
 					break;
 				case '-':
-					Local_xResultMessage.resultVal = (Local_xKeypadMessage.firstVal -'0') - (Local_xKeypadMessage.secondVal-'0');
+					Calc_xResultMessage.resultVal = (Calc_xKeypadMessage.firstVal -'0') - (Calc_xKeypadMessage.secondVal-'0');
 					break;
 				case '/':
-					if('0' == Local_xKeypadMessage.secondVal)
+					if('0' == Calc_xKeypadMessage.secondVal)
 					{
 						/*Can't divide by zero, may handle it in future with semaphore to lcd*/
-						Local_xResultMessage.resultVal = 0;
+						Calc_xResultMessage.resultVal = 0;
 					}
 					else
 					{
-						Local_xResultMessage.resultVal = (Local_xKeypadMessage.firstVal -'0') / (Local_xKeypadMessage.secondVal-'0');	
+						Calc_xResultMessage.resultVal = (Calc_xKeypadMessage.firstVal -'0') / (Calc_xKeypadMessage.secondVal-'0');	
 					}
 					
 					break;
 				case '*':
-					Local_xResultMessage.resultVal = (Local_xKeypadMessage.firstVal -'0') * (Local_xKeypadMessage.secondVal-'0');
+					Calc_xResultMessage.resultVal = (Calc_xKeypadMessage.firstVal -'0') * (Calc_xKeypadMessage.secondVal-'0');
 					break;
 				default:
 					/*Error*/
-					Local_xResultMessage.resultVal = 0;
+					Calc_xResultMessage.resultVal = 0;
 					break;
 			}
-			xQueueSend(Calc2LCD_Queue,&Local_xResultMessage,0);
+			crQUEUE_SEND(Copy_xHandle,Calc2LCD_Queue,&Calc_xResultMessage,0,&Calc_xObjectState);
 		}
 		else
 		{
 			/*Do Nothing*/
 		}
-		vTaskDelay(CALC_TASK_PERIODICITY);
+		crDELAY(Copy_xHandle,CALC_TASK_PERIODICITY);
 	}
+	crEND();
 }
 void LCD_vTask(void *Pv)
 {
 	BaseType_t Local_xObjectState = pdFALSE;
+	QueueSetMemberHandle_t Local_xReadyMember;
 	uint8_t Local_u8TimeBuffer[TIME_STRING_LENGTH];
+	uint8_t Local_u8LineBuffer[LCD_LINE_BUFFER_LENGTH];
+	uint8_t Local_u8Length = 0;
 	equationResultMSG_t Local_xResultEquation;
 	equationMSG_t Local_xCurrentEq;
 	
 	while(1)
 	{
-		vTaskDelay(LCD_TASK_PERIODICITY);
+		/*Sleep until one of the inputs holds something, the set returns them in the order they were sent*/
+		Local_xReadyMember = xQueueSelectFromSet(LCD_QueueSet,portMAX_DELAY);
 		
-		Local_xObjectState = xQueueReceive(Time2LCD_Queue,Local_u8TimeBuffer,0);
-		if(pdPASS == Local_xObjectState)
+		if(Local_xReadyMember == Time2LCD_Queue)
 		{
-			/*Print time*/
-			HAL_LCD_voidGoTo(LINE2,0);
-			HAL_LCD_voidSendString(Local_u8TimeBuffer);
+			Local_xObjectState = xQueueReceive(Time2LCD_Queue,Local_u8TimeBuffer,0);
+			if(pdPASS == Local_xObjectState)
+			{
+				/*Print time*/
+				HAL_LCD_voidWriteShadow(LINE2,0,(const char *)Local_u8TimeBuffer);
+			}
+			else{/*Do Nothing*/}
 		}
-		else{/*Do Nothing*/}
-		/*Check if clear notification was sent*/
-		Local_xObjectState  = xSemaphoreTake(KeyPad2LCD_ClearNotification,0);
-		if(pdPASS == Local_xObjectState)
+		else if(Local_xReadyMember == KeyPad2LCD_ClearNotification)
 		{
-			/*Clear LCD LINE 0*/
-			HAL_LCD_voidGoTo(LINE1,0);
-			HAL_LCD_voidSendString("             ");
+			/*Check if clear notification was sent*/
+			Local_xObjectState  = xSemaphoreTake(KeyPad2LCD_ClearNotification,0);
+			if(pdPASS == Local_xObjectState)
+			{
+				/*Clear LCD LINE 0*/
+				HAL_LCD_voidWriteShadow(LINE1,0,"             ");
+			}
+			else{/*Do Nothing*/}
 		}
-		else
+		else if(Local_xReadyMember == Calc2LCD_Queue)
 		{
-			/*Check other two queues result first then keypad*/
 			Local_xObjectState = xQueueReceive(Calc2LCD_Queue,&Local_xResultEquation,0);
 			if(pdPASS == Local_xObjectState)
 			{
 				/*Print Result*/
-				HAL_LCD_voidGoTo(LINE1,0);
-				HAL_LCD_voidSendChar(Local_xResultEquation.equation.firstVal);
-				HAL_LCD_voidSendChar(Local_xResultEquation.equation.Operator);
-				HAL_LCD_voidSendChar(Local_xResultEquation.equation.secondVal);
-				HAL_LCD_voidSendChar('=');
+				Local_u8LineBuffer[0] = Local_xResultEquation.equation.firstVal;
+				Local_u8LineBuffer[1] = Local_xResultEquation.equation.Operator;
+				Local_u8LineBuffer[2] = Local_xResultEquation.equation.secondVal;
+				Local_u8LineBuffer[3] = '=';
+				Local_u8Length = 4;
 				/*parse result
 				* /10 to get first digit as 10 / 10 = 1.
 				* %10 to get second digit as 10 %10 = 0.
 				*/
 				if(10 > Local_xResultEquation.resultVal)
 				{
-					HAL_LCD_voidSendChar((Local_xResultEquation.resultVal%(uint8_t)10)+'0');	
+					Local_u8LineBuffer[Local_u8Length++] = (Local_xResultEquation.resultVal%(uint8_t)10)+'0';
 				}
 				else
 				{
-					HAL_LCD_voidSendChar((Local_xResultEquation.resultVal/(uint8_t)10)+'0');
-					HAL_LCD_voidSendChar((Local_xResultEquation.resultVal%(uint8_t)10)+'0');	
+					Local_u8LineBuffer[Local_u8Length++] = (Local_xResultEquation.resultVal/(uint8_t)10)+'0';
+					Local_u8LineBuffer[Local_u8Length++] = (Local_xResultEquation.resultVal%(uint8_t)10)+'0';
 				}
-				
+				Local_u8LineBuffer[Local_u8Length] = '\0';
+				HAL_LCD_voidWriteShadow(LINE1,0,(const char *)Local_u8LineBuffer);
 			}
-			else
+			else{/*Do Nothing*/}
+		}
+		else if(Local_xReadyMember == Key2LCD_Queue)
+		{
+			Local_xObjectState = xQueueReceive(Key2LCD_Queue,&Local_xCurrentEq,0);
+			if(pdPASS == Local_xObjectState)
 			{
-				Local_xObjectState = xQueueReceive(Key2LCD_Queue,&Local_xCurrentEq,0);
-				if(pdPASS == Local_xObjectState)
+				/*Print Current input Equation*/
+				Local_u8LineBuffer[0] = Local_xCurrentEq.firstVal;
+				Local_u8Length = 1;
+				if(NO_INPUT_YET != Local_xCurrentEq.Operator)
 				{
-					/*Print Current input Equation*/					
-					HAL_LCD_voidGoTo(LINE1,0);
-					HAL_LCD_voidSendChar(Local_xCurrentEq.firstVal);
-					if(NO_INPUT_YET != Local_xCurrentEq.Operator)
-					{
-						HAL_LCD_voidSendChar(Local_xCurrentEq.Operator);
-						if(NO_INPUT_YET != Local_xCurrentEq.secondVal)
-						{
-							HAL_LCD_voidSendChar((Local_xCurrentEq.secondVal));
-						}
-						else{HAL_LCD_voidSendString("             ");}
-					}
-					else{HAL_LCD_voidSendString("             ");}
+					Local_u8LineBuffer[Local_u8Length++] = Local_xCurrentEq.Operator;
+				}
+				else{/*Do Nothing*/}
+				if((NO_INPUT_YET != Local_xCurrentEq.Operator) && (NO_INPUT_YET != Local_xCurrentEq.secondVal))
+				{
+					Local_u8LineBuffer[Local_u8Length++] = Local_xCurrentEq.secondVal;
 				}
 				else
 				{
-					/*Do Nothing*/
+					/*Blank the rest of the last equation*/
+					while(Local_u8Length < (LCD_LINE_BUFFER_LENGTH - 1))
+					{
+						Local_u8LineBuffer[Local_u8Length++] = ' ';
+					}
 				}
+				Local_u8LineBuffer[Local_u8Length] = '\0';
+				HAL_LCD_voidWriteShadow(LINE1,0,(const char *)Local_u8LineBuffer);
 			}
+			else{/*Do Nothing*/}
 		}
-		
-		
+		else
+		{
+			/*Do Nothing*/
+		}
+		/*Send only the cells changed above*/
+		Flush_vLcd();
 	}
 }
-void Timer_vTask(void *Pv)
+void Timer_vCoRoutine(CoRoutineHandle_t Copy_xHandle,UBaseType_t Copy_uxIndex)
 {
-	uint8_t Local_u8Seconds =0;
-	uint8_t Local_u8Minutes =0;
-	uint8_t Local_u8Houres =0;
-	uint8_t Local_u8TimeString[TIME_STRING_LENGTH];
-	BaseType_t Local_xObjectState = pdFALSE;
-	uint8_t Local_u8Start10Sec = 0;
-	static uint8_t TenSec_u8Counter =0;
+	static uint8_t Timer_u8Seconds =0;
+	static uint8_t Timer_u8Minutes =0;
+	static uint8_t Timer_u8Houres =0;
+	static uint8_t Timer_u8TimeString[TIME_STRING_LENGTH];
+	static BaseType_t Timer_xObjectState = pdFALSE;
+	(void)Copy_uxIndex;
+	crSTART(Copy_xHandle);
 	while(1)
 	{
-		vTaskDelay(TIME_TASK_PERIODICITY); /*Periodicity of task is 1Sec*/
-		Local_u8Seconds++;
-		if(UNIT_TIME_BASE == Local_u8Seconds)
+		crDELAY(Copy_xHandle,TIME_TASK_PERIODICITY); /*Periodicity of co-routine is 1Sec*/
+		Timer_u8Seconds++;
+		if(UNIT_TIME_BASE == Timer_u8Seconds)
 		{
-			Local_u8Seconds = 0;
-			Local_u8Minutes++;
-			if(UNIT_TIME_BASE == Local_u8Minutes)
+			Timer_u8Seconds = 0;
+			Timer_u8Minutes++;
+			if(UNIT_TIME_BASE == Timer_u8Minutes)
 			{
-				Local_u8Minutes =0;
-				Local_u8Houres = (Local_u8Houres+1) % 24;
+				Timer_u8Minutes =0;
+				Timer_u8Houres = (Timer_u8Houres+1) % 24;
 			}
 			else{/*Do Nothing*/}
 		}
 		else{/*Do Nothing*/}
 			
 		/*Call Time Gather Function*/
-		Get_vTimeNow(Local_u8Seconds,Local_u8Minutes,Local_u8Houres,Local_u8TimeString);
+		Get_vTimeNow(Timer_u8Seconds,Timer_u8Minutes,Timer_u8Houres,Timer_u8TimeString);
 		/*Send current time to LCD through (Time2LCD_Queue) */
-		Local_xObjectState = xQueueSend(Time2LCD_Queue,Local_u8TimeString,10);
-		if(pdFALSE == Local_xObjectState)
+		crQUEUE_SEND(Copy_xHandle,Time2LCD_Queue,Timer_u8TimeString,0,&Timer_xObjectState);
+		if(pdFALSE == Timer_xObjectState)
 		{
 			/*Do nothing
 			  This may be used in future to perform some actions if sending was failed
 			*/
 		}
 		else{/*Do nothing*/}
-		
-		/*Check if 10 Sec semaphore was posted*/
-		Local_xObjectState = xSemaphoreTake(KeyPad2Timer_StartCounting,0);
-		if(pdTRUE == Local_xObjectState)
+	}
+	crEND();
+}
+
+#if configSUPPORT_STATIC_ALLOCATION == 1
+/*Kernel callback, the idle task is created by vTaskStartScheduler from this memory*/
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer,StackType_t **ppxIdleTaskStackBuffer,uint32_t *pulIdleTaskStackSize)
+{
+	*ppxIdleTaskTCBBuffer = &Idle_TaskBuffer;
+	*ppxIdleTaskStackBuffer = Idle_TaskStack;
+	*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+#endif
+
+void LCD_vTransferDone(void)
+{
+	/*Runs in the timer 2 interrupt, the kernel call goes on the interrupt stack*/
+	portRUN_ON_ISR_STACK(&LCD_vNotifyTask);
+}
+
+static void LCD_vNotifyTask(void)
+{
+	BaseType_t Local_xHigherPriorityTaskWoken = pdFALSE;
+	vTaskNotifyGiveFromISR(LCD_TaskHandle,&Local_xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(Local_xHigherPriorityTaskWoken);
+}
+
+static void Flush_vLcd(void)
+{
+	/*Only wait when the engine still holds the last refresh, the timeout covers a
+	  notification taken by an earlier wait*/
+	while(LCD_FIFO_FULL == HAL_LCD_u8FlushShadow())
+	{
+		ulTaskNotifyTake(pdTRUE,LCD_TASK_PERIODICITY);
+	}
+}
+
+/*Keypad callback, runs in the tick interrupt (from the tick hook)*/
+void Keypad_vKeyEvent(const Keypad_Event_t *Copy_pxEvent)
+{
+	/*A held key counts once, so releases and repeats are dropped here rather than
+	taking queue slots from typed ahead keys*/
+	if(KEYPAD_PRESS == Copy_pxEvent->Type)
+	{
+		/*No yield needed, the tick interrupt switches to the highest ready task anyway*/
+		if(errQUEUE_FULL == xQueueSendFromISR(KeyEvent_Queue,Copy_pxEvent,NULL))
 		{
-			/*Start counting 10 sec*/
-				Local_u8Start10Sec=1;
+			KeyPad_u16Overflows++;
 		}
 		else{/*Do Nothing*/}
-		/*Check if stop 10 Sec semaphore was posted*/
-		Local_xObjectState = xSemaphoreTake(KeyPad2Timer_StopCounting,0);
-		if(pdTRUE == Local_xObjectState)
+	}
+	else{/*Do Nothing*/}
+}
+
+uint16_t KeyPad_u16GetOverflows(void)
+{
+	uint16_t Local_u16Overflows;
+	/*16 bit, written from the tick interrupt*/
+	taskENTER_CRITICAL();
+	Local_u16Overflows = KeyPad_u16Overflows;
+	taskEXIT_CRITICAL();
+	return Local_u16Overflows;
+}
+
+static void KeyPad_vHandleKey(uint8_t Copy_u8Key,keypadBuffer_t *Copy_pxKeyPadBuffer)
+{
+	uint8_t Local_u8ErrorState = Check_vKeypadInput(Copy_u8Key,Copy_pxKeyPadBuffer);
+	if(pdTRUE == Local_u8ErrorState)
+	{
+		/*Clear LCD Now (wrong Equation)*/
+		xSemaphoreGive(KeyPad2LCD_ClearNotification);
+	}
+	else
+	{
+		if(1 == Copy_pxKeyPadBuffer->completeFlag)
 		{
-			/*Stop counting 10 sec*/
-			Local_u8Start10Sec=0;
+			/*Send equation to calc task*/
+			xQueueSend(Key2Calc_Queue,&(Copy_pxKeyPadBuffer->MSG),0);
+			Copy_pxKeyPadBuffer->completeFlag =0;
 		}
-		else{/*Do Nothing*/}
-		
-		/*Take action if start counting was posted*/
-		if(1 == Local_u8Start10Sec)
+		else
 		{
-			TenSec_u8Counter++;
-			if(10 == TenSec_u8Counter)
-			{
-				/*Give indication that 10 sec passed using Timer2KeyPad_TenSecondsNotification */
-				xSemaphoreGive(Timer2KeyPad_TenSecondsNotification);
-				TenSec_u8Counter=0;
-				Local_u8Start10Sec=0;
-			}
-			else{;}
+			/*send to LCD Task, only the latest state of the equation matters there*/
+			xQueueOverwrite(Key2LCD_Queue,&(Copy_pxKeyPadBuffer->MSG));
 		}
-		else{;}
-			
 	}
 }
 
+/*Tick hook, runs in the tick interrupt every 1 ms.  The scan period is counted in ticks rather
+  than calls, the hook does not run for the ticks tickless idle suppresses*/
+void vApplicationTickHook(void)
+{
+	TickType_t Local_xNow = xTaskGetTickCountFromISR();
+	if(KEYPAD_SCAN_PERIOD <= (TickType_t)(Local_xNow - KeyPad_xLastScanTick))
+	{
+		KeyPad_xLastScanTick = Local_xNow;
+		HAL_Keypad_voidScanTick();
+	}
+	else{/*Do Nothing*/}
+}
+
+#if configUSE_TICKLESS_IDLE == 1
+/*Called by the idle task before it sleeps.  The tick that ends a sleep is counted after its hook
+  has run, so the sleep ends a tick before the next scan is due and the tick after it scans on time*/
+uint16_t KeyPad_u16LimitIdleTime(uint16_t Copy_u16ExpectedIdleTime)
+{
+	TickType_t Local_xSinceScan;
+	TickType_t Local_xUntilScan = 0;
+	/*16 bit, written from the tick interrupt*/
+	taskENTER_CRITICAL();
+	Local_xSinceScan = xTaskGetTickCount() - KeyPad_xLastScanTick;
+	taskEXIT_CRITICAL();
+	if((TickType_t)(KEYPAD_SCAN_PERIOD - 1) > Local_xSinceScan)
+	{
+		Local_xUntilScan = (TickType_t)(KEYPAD_SCAN_PERIOD - 1) - Local_xSinceScan;
+	}
+	else{/*Scan due, do not sleep*/}
+	if(Copy_u16ExpectedIdleTime > Local_xUntilScan)
+	{
+		Copy_u16ExpectedIdleTime = Local_xUntilScan;
+	}
+	else{/*Do Nothing*/}
+	return Copy_u16ExpectedIdleTime;
+}
+#endif
+
+void Inactivity_vCallback(TimerHandle_t Copy_xTimer)
+{
+	(void)Copy_xTimer;
+	/*Runs in the timer service task, hand the clear over to the keypad task which owns the input*/
+	xTaskNotifyGive(KeyPad_TaskHandle);
+}
+
+#if configSUPPORT_STATIC_ALLOCATION == 1
+/*Kernel callback, the timer service task is created by vTaskStartScheduler from this memory*/
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer,StackType_t **ppxTimerTaskStackBuffer,uint32_t *pulTimerTaskStackSize)
+{
+	*ppxTimerTaskTCBBuffer = &TimerSvc_TaskBuffer;
+	*ppxTimerTaskStackBuffer = TimerSvc_TaskStack;
+	*pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
+
+/*Idle task hook, runs the co-routines and sends the scheduler trace in the CPU time no task needs*/
+void vApplicationIdleHook(void)
+{
+	vCoRoutineSchedule();
+#if configUSE_TRACE_RECORDER == 1
+	TRACE_voidDrain();
+#endif
+}
+
 
 /****************************** Private functions implementation  ***********************************/
 
@@ -391,7 +613,6 @@ static void Get_vTimeNow(uint8_t Copy_u8Seconds,uint8_t Copy_u8Min,uint8_t Copy_
 static uint8_t Check_vKeypadInput(uint8_t Copy_u8KeyValue,keypadBuffer_t *Copy_pxKeypadBuffer)
 {
 	uint8_t Local_u8ErrorState = pdFALSE;
-	static uint8_t Key_u8PositionIndicator=0;
 	
 	/*This flag to help monitor 10 sec without any activity on calculator and if so the LCD will be
 		cleared.
@@ -401,7 +622,7 @@ static uint8_t Check_vKeypadInput(uint8_t Copy_u8KeyValue,keypadBuffer_t *Copy_p
 	if(KEYPAD_SMALLEST_VALUE <= Copy_u8KeyValue && KEYPAD_LARGEST_VALUE >= Copy_u8KeyValue)
 	{
 		/*Number was pressed*/
-		if(0 == Key_u8PositionIndicator)
+		if(0 == Copy_pxKeypadBuffer->positionIndicator)
 		{
 			/*First number*/
 			Copy_pxKeypadBuffer->MSG.firstVal = Copy_u8KeyValue;
@@ -409,12 +630,12 @@ static uint8_t Check_vKeypadInput(uint8_t Copy_u8KeyValue,keypadBuffer_t *Copy_p
 			Copy_pxKeypadBuffer->MSG.Operator = NO_INPUT_YET;
 			Copy_pxKeypadBuffer->MSG.secondVal = NO_INPUT_YET;
 		}
-		else if(1 == Key_u8PositionIndicator)
+		else if(1 == Copy_pxKeypadBuffer->positionIndicator)
 		{
 			/*Won't accept it*/
 			Local_u8ErrorState = pdTRUE;
 		}
-		else if(2 == Key_u8PositionIndicator)
+		else if(2 == Copy_pxKeypadBuffer->positionIndicator)
 		{
 			Copy_pxKeypadBuffer->MSG.secondVal = Copy_u8KeyValue;
 		}
@@ -426,7 +647,7 @@ static uint8_t Check_vKeypadInput(uint8_t Copy_u8KeyValue,keypadBuffer_t *Copy_p
 	else if(KEYPAD_CALCULATE_VALUE == Copy_u8KeyValue)
 	{
 		/*Start calculation*/
-		if(3 == Key_u8PositionIndicator)
+		if(3 == Copy_pxKeypadBuffer->positionIndicator)
 		{
 			Copy_pxKeypadBuffer->completeFlag = 1;	
 			
@@ -441,7 +662,7 @@ static uint8_t Check_vKeypadInput(uint8_t Copy_u8KeyValue,keypadBuffer_t *Copy_p
 	else
 	{
 		/*Operator*/
-		if(1 == Key_u8PositionIndicator)
+		if(1 == Copy_pxKeypadBuffer->positionIndicator)
 		{
 			Copy_pxKeypadBuffer->MSG.Operator = Copy_u8KeyValue;
 			/*Indicator that only first number and operator were entered (this will help in LCD task)*/
@@ -456,13 +677,23 @@ static uint8_t Check_vKeypadInput(uint8_t Copy_u8KeyValue,keypadBuffer_t *Copy_p
 	/*Increase indicator to move to next operand or operator when calling this function again*/
 	if(pdTRUE == Local_u8ErrorState)
 	{
-		Key_u8PositionIndicator =0;	
+		Copy_pxKeypadBuffer->positionIndicator =0;	
 	}
 	else
 	{
-		Key_u8PositionIndicator = (Key_u8PositionIndicator +1 )%4;	
+		Copy_pxKeypadBuffer->positionIndicator = (Copy_pxKeypadBuffer->positionIndicator +1 )%4;	
 	}
 	
 	
 	return (Local_u8ErrorState);
+}
+
+static void Check_vResetKeypadInput(keypadBuffer_t *Copy_pxKeypadBuffer)
+{
+	Copy_pxKeypadBuffer->MSG.firstVal = NO_INPUT_YET;
+	Copy_pxKeypadBuffer->MSG.Operator = NO_INPUT_YET;
+	Copy_pxKeypadBuffer->MSG.secondVal = NO_INPUT_YET;
+	Copy_pxKeypadBuffer->updateFlag = 0;
+	Copy_pxKeypadBuffer->completeFlag = 0;
+	Copy_pxKeypadBuffer->positionIndicator = 0;
 }
\ No newline at end of file
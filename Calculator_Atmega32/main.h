@@ -4,6 +4,11 @@
 #ifndef MAIN_H_
 #define MAIN_H_
 #include <stdint-gcc.h>
+#include "Keypad_interface.h"
+/*Kernel types of the co-routine and timer callbacks*/
+#include "FreeRTOS.h"
+#include "croutine.h"
+#include "timers.h"
 /****************************** UserDefined Datatype ***********************************/
 
 typedef struct
@@ -18,6 +23,7 @@ typedef struct
 	equationMSG_t MSG;
 	uint8_t updateFlag;
 	uint8_t completeFlag;
+	uint8_t positionIndicator;	/*0 first number, 1 operator, 2 second number, 3 '='*/
 }keypadBuffer_t;
 
 typedef struct
@@ -29,35 +35,49 @@ typedef struct
 /****************************** Macros Definitions ***********************************/
 #define LCD_Task_STACK_SIZE				(uint16_t)260
 #define KEYPAD_Task_STACK_SIZE			(uint16_t)260
-#define CALC_Task_STACK_SIZE			(uint16_t)100
-#define TIMING_Task_STACK_SIZE			(uint16_t)260
 
 /*4 is the highest*/
 #define LCD_Task_PRIORITY				(uint8_t)1
-#define CALC_Task_PRIORITY				(uint8_t)2
 #define KEYPAD_Task_PRIORITY			(uint8_t)3
-#define TIMING_Task_PRIORITY			(uint8_t)4
+/*Co-routine priorities, only relative to each other (all run below every task)*/
+#define CALC_CoRoutine_PRIORITY			(uint8_t)0
+#define TIMING_CoRoutine_PRIORITY		(uint8_t)1
 
 /*Queues lengths*/
-#define KEY2CALC_QUEUE_LENGTH			(uint8_t)1
+#define KEY2CALC_QUEUE_LENGTH			(uint8_t)2
 #define KEY2LCD_QUEUE_LENGTH			(uint8_t)1
 #define CALC2LCD_QUEUE_LENGTH			(uint8_t)1
 #define TIM2LCD_QUEUE_LENGTH			(uint8_t)1
+/*Typeahead, keys the keypad task has not handled yet*/
+#define KEYEVENT_QUEUE_LENGTH			(uint8_t)8
+/*Keys the keypad task takes from the typeahead at once, kept on its stack*/
+#define KEYEVENT_BATCH_LENGTH			(uint8_t)4
+/*The LCD set holds an event for every item its members can hold at once*/
+#define LCD_QUEUESET_LENGTH				(uint8_t)(TIM2LCD_QUEUE_LENGTH + 1 + CALC2LCD_QUEUE_LENGTH + KEY2LCD_QUEUE_LENGTH)
 /*Queues widths*/
 #define KEY2CALC_QUEUE_WIDTH			(uint16_t)sizeof(equationMSG_t)
 #define KEY2LCD_QUEUE_WIDTH				(uint16_t)sizeof(equationMSG_t)
 #define CALC2LCD_QUEUE_WIDTH			(uint16_t)sizeof(equationResultMSG_t)
 #define TIM2LCD_QUEUE_WIDTH				(uint8_t)10
+#define KEYEVENT_QUEUE_WIDTH			(uint8_t)sizeof(Keypad_Event_t)
 /*Time macros*/
 #define UNIT_TIME_BASE					(uint8_t)60
 #define TIME_STRING_LENGTH				(uint8_t)10
+/*Longest line the LCD task writes, terminator included*/
+#define LCD_LINE_BUFFER_LENGTH			(uint8_t)16
 /*equation no input sign*/
 #define NO_INPUT_YET					(int8_t)-1
 /*Periodicity of tasks*/
+/*The LCD task waits on its queue set, this only bounds its wait for the LCD engine*/
 #define LCD_TASK_PERIODICITY			((uint16_t)45)
+/*Longest the keypad task waits for a key before checking the inactivity timer*/
 #define KEYPAD_TASK_PERIODICITY			((uint16_t)145)
+/*Keypad scan every 5 ticks (5 ms), the debounce and repeat times of Keypad_cnfg.h count these scans*/
+#define KEYPAD_SCAN_PERIOD				((uint8_t)5)
 #define CALC_TASK_PERIODICITY			((uint16_t)403)
 #define TIME_TASK_PERIODICITY			((uint16_t)1000)
+/*Clear an incomplete equation after this long without any key*/
+#define INACTIVITY_TIMEOUT_PERIOD		((uint16_t)10000)
 
 /*Keypad Macros*/
 #define KEYPAD_SMALLEST_VALUE			(uint8_t)'0'
@@ -66,9 +86,28 @@ typedef struct
 /****************************** Tasks Decleration ***********************************/
 
 extern void KeyPad_vTask(void *Pv);
-extern void Calc_vTask(void *Pv);
 extern void LCD_vTask(void *Pv);
-extern void Timer_vTask(void *Pv);
+
+/****************************** Co-routines Decleration ***********************************/
+
+extern void Calc_vCoRoutine(CoRoutineHandle_t Copy_xHandle,UBaseType_t Copy_uxIndex);
+extern void Timer_vCoRoutine(CoRoutineHandle_t Copy_xHandle,UBaseType_t Copy_uxIndex);
+
+/****************************** Timers Callbacks Decleration ***********************************/
+
+extern void Inactivity_vCallback(TimerHandle_t Copy_xTimer);
+
+/****************************** Drivers Callbacks Decleration ***********************************/
+
+extern void LCD_vTransferDone(void);
+extern void Keypad_vKeyEvent(const Keypad_Event_t *Copy_pxEvent);
+
+/****************************** Statistics ***********************************/
+
+/**
+* @brief: number of keys lost because the typeahead queue was full, since reset (wraps).
+*/
+extern uint16_t KeyPad_u16GetOverflows(void);
 
 /****************************** Private Functions Decleration ***********************************/
 /**
@@ -79,5 +118,21 @@ extern void Timer_vTask(void *Pv);
 * @Param: Copy_pu8String	string carry the current time value.
 */
 static void Get_vTimeNow(uint8_t Copy_u8Seconds,uint8_t Copy_u8Min,uint8_t Copy_u8Hours,uint8_t *Copy_pu8String);
+/**
+* @brief: send the changed cells of the LCD shadow, waits for the LCD engine only if it is full.
+*/
+static void Flush_vLcd(void);
+static void LCD_vNotifyTask(void);
+/**
+* @brief: run one key through the input state machine and send the result on.
+* @Param: Copy_u8Key			key value from the keypad.
+* @Param: Copy_pxKeyPadBuffer	equation being typed.
+*/
+static void KeyPad_vHandleKey(uint8_t Copy_u8Key,keypadBuffer_t *Copy_pxKeyPadBuffer);
 static uint8_t Check_vKeypadInput(uint8_t Copy_u8KeyValue,keypadBuffer_t *Copy_pxKeypadBuffer);
+/**
+* @brief: drop the equation being typed, the next key starts a new one.
+* @Param: Copy_pxKeypadBuffer	equation being typed.
+*/
+static void Check_vResetKeypadInput(keypadBuffer_t *Copy_pxKeypadBuffer);
 #endif /* MAIN_H_ */
\ No newline at end of file